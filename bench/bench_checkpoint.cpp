@@ -0,0 +1,92 @@
+// Nova Game Engine - Checkpoint benchmark
+// Loads a synthetic place (default 20k parts, half of them dynamic) into a
+// DataModel with physics running, then times Checkpoint::Save. "stall" is
+// the time Save holds the calling thread: the deep Clone of the tree, the
+// reference scrub and the body state reads under the physics lock. "write"
+// is what the background thread adds on top: encoding and the file write.
+//   CheckpointBench [parts] [iterations]
+
+#include "Engine/Nova.hpp"
+#include "Engine/Reflection/Checkpoint.hpp"
+#include "Engine/Reflection/ClassDescriptor.hpp"
+#include "Engine/Reflection/LevelLoader.hpp"
+#include "PlaceGenerator.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Nova;
+
+static double Since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    int partCount = argc > 1 ? std::atoi(argv[1]) : 20000;
+    int iterations = std::max(argc > 2 ? std::atoi(argv[2]) : 10, 1);
+
+    RegisterClasses();
+
+    auto dir = std::filesystem::temp_directory_path();
+    std::string placePath = (dir / "nova_checkpoint_bench.rbxl").string();
+    std::string checkpointPath = (dir / "nova_checkpoint_bench.nvck").string();
+    {
+        PlaceGenerator::Options options;
+        options.parts = partCount;
+        options.anchored = 0.5f;
+        std::ofstream out(placePath, std::ios::trunc);
+        PlaceGenerator::WriteXml(out, options);
+        if (!out) {
+            printf("Checkpoint: cannot write %s\n", placePath.c_str());
+            return 1;
+        }
+    }
+
+    auto dm = std::make_shared<DataModel>();
+    dm->GetService<Workspace>();
+    auto physics = dm->GetService<PhysicsService>();
+    LevelLoader::Load(placePath, dm);
+    physics->Start();
+    // Let the physics thread build the bodies and put some of them in motion
+    for (int frame = 0; frame < 30; frame++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(16));
+        physics->Step(1.0f / 60.0f);
+    }
+
+    Checkpoint checkpoint;
+    std::vector<double> stalls;
+    double writeTotal = 0.0;
+    for (int i = 0; i < iterations; i++) {
+        auto start = std::chrono::steady_clock::now();
+        if (!checkpoint.Save(*dm, checkpointPath)) {
+            printf("Checkpoint: save %d refused\n", i);
+            return 1;
+        }
+        stalls.push_back(Since(start));
+        checkpoint.Wait();
+        writeTotal += Since(start) - stalls.back();
+    }
+
+    std::sort(stalls.begin(), stalls.end());
+    double stallTotal = 0.0;
+    for (double s : stalls) stallTotal += s;
+    auto bytes = std::filesystem::file_size(checkpointPath);
+
+    printf("Checkpoint: %d parts, %zu instances, %d iterations, %.1f MB\n",
+        partCount, dm->CountDescendants(), iterations, bytes / (1024.0 * 1024.0));
+    printf("  %-6s %8.2f ms mean  %8.2f ms median  %8.2f ms max  %8.0f parts/s\n", "stall",
+        stallTotal / iterations * 1000.0, stalls[stalls.size() / 2] * 1000.0, stalls.back() * 1000.0,
+        partCount * iterations / stallTotal);
+    printf("  %-6s %8.2f ms mean\n", "write", writeTotal / iterations * 1000.0);
+
+    physics->Stop();
+    std::filesystem::remove(placePath);
+    std::filesystem::remove(checkpointPath);
+    return 0;
+}
@@ -0,0 +1,110 @@
+// Nova Game Engine - Clone throughput benchmark
+// Clones a welded multi-part model and reports parts per second for:
+//   legacy  the pre-change Clone algorithm: a descriptor lookup by class name
+//           per node, the class's own property map, boxed get/set, and
+//           SetParent per child. It runs on today's PropertyValue, SetParent
+//           and pooled allocation, and like the original it skips inherited
+//           properties and names, so it is a lower bound on the old cost
+//           rather than a measurement of the old build.
+//   boxed   today's flattened table (inherited properties and names), but
+//           with boxed get/set and SetParent per child, isolating those costs.
+//   typed   Instance::Clone.
+
+#include "Engine/Nova.hpp"
+#include "Engine/Objects/InstanceFactory.hpp"
+#include "Engine/Reflection/ClassDescriptor.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+using namespace Nova;
+
+static std::shared_ptr<Instance> BuildModel(int partCount) {
+    auto model = InstanceFactory::Get().Create("Model");
+    std::shared_ptr<Part> previous;
+    for (int i = 0; i < partCount; i++) {
+        auto part = std::static_pointer_cast<Part>(InstanceFactory::Get().Create("Part"));
+        part->SetName("Part" + std::to_string(i));
+        part->cframe.position = Vector3(float(i % 10) * 4.0f, float(i / 100) * 2.0f, float((i / 10) % 10) * 4.0f);
+        part->size = Vector3(4.0f, 1.0f, 2.0f);
+        part->brickColor = 21 + i % 8;
+        part->SetParent(model);
+
+        if (previous) {
+            auto weld = std::static_pointer_cast<Weld>(InstanceFactory::Get().Create("Weld"));
+            weld->Part0 = previous;
+            weld->Part1 = part;
+            weld->SetParent(part);
+        }
+        previous = part;
+    }
+    return model;
+}
+
+// The original Instance::Clone body, moved out of the class
+static std::shared_ptr<Instance> LegacyClone(Instance* source) {
+    auto inst = InstanceFactory::Get().Create(source->GetClassName());
+    if (!inst) return nullptr;
+
+    auto* desc = ClassDescriptor::Get(source->GetClassName());
+    if (desc) {
+        for (auto& [name, accessor] : desc->properties) {
+            PropertyValue val = accessor->get(source);
+            accessor->set(inst.get(), val);
+        }
+    }
+
+    for (auto& child : source->GetChildren()) {
+        auto childClone = LegacyClone(child.get());
+        if (childClone) {
+            childClone->SetParent(inst);
+        }
+    }
+    return inst;
+}
+
+// Flattened table, but every property boxed and each child attached with SetParent
+static std::shared_ptr<Instance> BoxedClone(Instance* source) {
+    auto copy = InstanceFactory::Get().Create(source->GetClassName());
+    if (!copy) return nullptr;
+    copy->SetName(source->GetName());
+    if (auto* desc = source->GetDescriptor()) {
+        for (auto& property : desc->flatProperties) {
+            property.accessor->set(copy.get(), property.accessor->get(source));
+        }
+    }
+    for (auto& child : source->GetChildren()) {
+        if (auto childCopy = BoxedClone(child.get())) childCopy->SetParent(copy);
+    }
+    return copy;
+}
+
+template<typename Fn>
+static void Run(const char* label, int iterations, int partCount, Fn&& clone) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        auto copy = clone();
+        if (!copy) {
+            printf("%s: clone failed\n", label);
+            return;
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double parts = double(iterations) * partCount;
+    printf("  %-10s %8.2f ms total  %10.0f parts/s\n", label, seconds * 1000.0, parts / seconds);
+}
+
+int main(int argc, char* argv[]) {
+    int partCount = argc > 1 ? std::atoi(argv[1]) : 500;
+    int iterations = argc > 2 ? std::atoi(argv[2]) : 200;
+
+    RegisterClasses();
+    auto model = BuildModel(partCount);
+
+    printf("Clone: %d parts + welds, %d iterations\n", partCount, iterations);
+    Run("legacy", iterations, partCount, [&] { return LegacyClone(model.get()); });
+    Run("boxed", iterations, partCount, [&] { return BoxedClone(model.get()); });
+    Run("typed", iterations, partCount, [&] { return model->Clone(); });
+    return 0;
+}
@@ -0,0 +1,84 @@
+// Nova Game Engine - LevelLoader load-time benchmark
+// Writes a synthetic place (default 100k anchored parts, about half of them
+// welded to a neighbour) as .rbxl XML and as a binary place, then times
+// LevelLoader::Load on both, into a detached root and into a DataModel with a
+// live Workspace. The DataModel rows include the service merge, the batch
+// flush and Workspace/physics registration of every part.
+//   LevelLoadBench [parts] [iterations]
+
+#include "Engine/Nova.hpp"
+#include "Engine/Objects/InstanceFactory.hpp"
+#include "Engine/Reflection/ClassDescriptor.hpp"
+#include "Engine/Reflection/LevelLoader.hpp"
+#include "PlaceGenerator.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace Nova;
+
+static bool WritePlace(const std::string& path, int partCount) {
+    PlaceGenerator::Options options;
+    options.parts = partCount;
+    std::ofstream out(path, std::ios::trunc);
+    PlaceGenerator::WriteXml(out, options);
+    return static_cast<bool>(out);
+}
+
+static double LoadSeconds(const std::string& path, int iterations, bool intoDataModel, size_t& instances) {
+    double total = 0.0;
+    for (int i = 0; i < iterations; i++) {
+        std::shared_ptr<Instance> root;
+        if (intoDataModel) {
+            auto dm = std::make_shared<DataModel>();
+            dm->GetService<Workspace>();
+            dm->GetService<PhysicsService>();
+            root = dm;
+        } else {
+            root = InstanceFactory::Get().Create("Model");
+        }
+        auto start = std::chrono::steady_clock::now();
+        LevelLoader::Load(path, root);
+        total += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        instances = root->CountDescendants();
+    }
+    return total / iterations;
+}
+
+int main(int argc, char* argv[]) {
+    int partCount = argc > 1 ? std::atoi(argv[1]) : 100000;
+    int iterations = argc > 2 ? std::atoi(argv[2]) : 3;
+
+    RegisterClasses();
+
+    auto dir = std::filesystem::temp_directory_path();
+    std::string xmlPath = (dir / "nova_load_bench.rbxl").string();
+    std::string binaryPath = (dir / "nova_load_bench.nvpl").string();
+    if (!WritePlace(xmlPath, partCount)) {
+        printf("LevelLoad: cannot write %s\n", xmlPath.c_str());
+        return 1;
+    }
+
+    auto converted = InstanceFactory::Get().Create("Model");
+    LevelLoader::Load(xmlPath, converted);
+    if (!LevelLoader::SaveBinary(binaryPath, converted)) return 1;
+
+    printf("LevelLoad: %d parts, %d iterations\n", partCount, iterations);
+    for (auto& [label, path] : { std::pair{ "xml", xmlPath }, std::pair{ "binary", binaryPath } }) {
+        auto bytes = std::filesystem::file_size(path);
+        for (bool intoDataModel : { false, true }) {
+            size_t instances = 0;
+            double seconds = LoadSeconds(path, iterations, intoDataModel, instances);
+            printf("  %-8s %-9s %10.1f ms  %10.0f parts/s  %8.1f MB  %zu instances\n",
+                label, intoDataModel ? "datamodel" : "model", seconds * 1000.0, partCount / seconds,
+                bytes / (1024.0 * 1024.0), instances);
+        }
+    }
+
+    std::filesystem::remove(xmlPath);
+    std::filesystem::remove(binaryPath);
+    return 0;
+}
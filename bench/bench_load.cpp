@@ -0,0 +1,147 @@
+// Nova Game Engine - LevelLoader::Load cost report
+// Loads an existing place (XML, binary or checkpoint, e.g. one written by
+// NovaPlaceGen) and reports wall time, heap allocations and peak resident set
+// size. By default the target is a DataModel with a live Workspace, so the
+// numbers include the service merge, the batch flush and physics registration;
+// "model" loads into a detached root to isolate decoding. Allocations are
+// counted by replacing the global operator new, so they cover the loader's
+// worker threads too.
+//   LoadBench <place> [iterations] [datamodel|model]
+
+#include "Engine/Nova.hpp"
+#include "Engine/Objects/InstanceFactory.hpp"
+#include "Engine/Reflection/ClassDescriptor.hpp"
+#include "Engine/Reflection/LevelLoader.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <new>
+#include <string_view>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+using namespace Nova;
+
+static std::atomic<uint64_t> allocationCount{ 0 };
+static std::atomic<uint64_t> allocationBytes{ 0 };
+
+static void* CountedAlloc(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocationBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc();
+}
+
+static void* CountedAlignedAlloc(std::size_t size, std::align_val_t align) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocationBytes.fetch_add(size, std::memory_order_relaxed);
+    std::size_t alignment = static_cast<std::size_t>(align);
+#ifdef _WIN32
+    void* ptr = _aligned_malloc(size ? size : 1, alignment);
+#else
+    void* ptr = std::aligned_alloc(alignment, (std::max<std::size_t>(size, 1) + alignment - 1) / alignment * alignment);
+#endif
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+static void AlignedFree(void* ptr) {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+void* operator new(std::size_t size) { return CountedAlloc(size); }
+void* operator new[](std::size_t size) { return CountedAlloc(size); }
+void* operator new(std::size_t size, std::align_val_t align) { return CountedAlignedAlloc(size, align); }
+void* operator new[](std::size_t size, std::align_val_t align) { return CountedAlignedAlloc(size, align); }
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { AlignedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { AlignedFree(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { AlignedFree(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { AlignedFree(ptr); }
+
+static double PeakRssMB() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return 0.0;
+    return double(counters.PeakWorkingSetSize) / (1024.0 * 1024.0);
+#else
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return double(usage.ru_maxrss) / (1024.0 * 1024.0);  // bytes
+#else
+    return double(usage.ru_maxrss) / 1024.0;  // kilobytes
+#endif
+#endif
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        printf("usage: %s <place> [iterations] [datamodel|model]\n", argv[0]);
+        return 2;
+    }
+    const char* path = argv[1];
+    int iterations = argc > 2 ? std::max(1, std::atoi(argv[2])) : 5;
+    bool intoDataModel = argc <= 3 || std::string_view(argv[3]) != "model";
+
+    RegisterClasses();
+    double baselineMB = PeakRssMB();
+
+    double best = 0.0, total = 0.0;
+    uint64_t count = 0, bytes = 0;
+    size_t instances = 0;
+    for (int i = 0; i < iterations; i++) {
+        std::shared_ptr<Instance> root;
+        if (intoDataModel) {
+            auto dm = std::make_shared<DataModel>();
+            dm->GetService<Workspace>();
+            dm->GetService<PhysicsService>();
+            root = dm;
+        } else {
+            root = InstanceFactory::Get().Create("Model");
+        }
+        uint64_t countBefore = allocationCount.load();
+        uint64_t bytesBefore = allocationBytes.load();
+        auto start = std::chrono::steady_clock::now();
+        LevelLoader::Load(path, root);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        count += allocationCount.load() - countBefore;
+        bytes += allocationBytes.load() - bytesBefore;
+
+        best = i == 0 ? seconds : std::min(best, seconds);
+        total += seconds;
+        instances = root->CountDescendants();
+    }
+
+    if (instances == 0) {
+        printf("%s: nothing loaded\n", path);
+        return 1;
+    }
+
+    std::error_code ec;
+    auto fileSize = std::filesystem::file_size(path, ec);
+    printf("Load: %s, %.1f MB, %zu instances, %d iterations, into %s\n",
+        path, fileSize / (1024.0 * 1024.0), instances, iterations, intoDataModel ? "a DataModel" : "a detached Model");
+    printf("  %-12s %10.1f ms best  %10.1f ms mean\n", "wall", best * 1000.0, total * 1000.0 / iterations);
+    printf("  %-12s %10.0f per load  %8.1f per instance  %8.1f MB per load\n", "allocations",
+        double(count) / iterations, double(count) / iterations / instances,
+        double(bytes) / iterations / (1024.0 * 1024.0));
+    printf("  %-12s %10.1f MB  (%.1f MB before loading)\n", "peak RSS", PeakRssMB(), baselineMB);
+    return 0;
+}
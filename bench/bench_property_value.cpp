@@ -0,0 +1,92 @@
+// Nova Game Engine - PropertyValue microbenchmark
+// Compares the compact refcounted PropertyValue against the previous
+// std::variant-based layout on the operations the reflection path performs:
+// boxing a member on get, copying values around, and unboxing on set.
+// Strings up to PropertyValue::InlineStringCapacity bytes box without touching
+// the heap; longer ones still allocate once (the variant allocates past its
+// 15-byte SSO buffer), so both lengths are measured.
+
+#include "Common/PropertyValue.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+using namespace Nova;
+
+// The pre-change type, kept verbatim in layout for comparison
+struct LegacyPropertyValue {
+    enum class Kind { Nil, Bool, Int, Float, String, Vector3, CFrame, Color3 };
+    struct Color3Value { float r = 1, g = 1, b = 1; };
+
+    std::variant<std::nullopt_t, bool, int64_t, double, std::string, Vector3, CFrame, Color3Value> storage;
+    Kind kind;
+
+    LegacyPropertyValue() : storage(std::nullopt), kind(Kind::Nil) {}
+    LegacyPropertyValue(double v) : storage(v), kind(Kind::Float) {}
+    LegacyPropertyValue(const std::string& v) : storage(v), kind(Kind::String) {}
+    LegacyPropertyValue(const CFrame& v) : storage(v), kind(Kind::CFrame) {}
+
+    double toFloat() const { return std::get<double>(storage); }
+    const std::string& toString() const { return std::get<std::string>(storage); }
+    const CFrame& toCFrame() const { return std::get<CFrame>(storage); }
+};
+
+// Printed at the end so the loops are not optimised away
+static size_t gSink = 0;
+
+template<typename Fn>
+static double Measure(int iterations, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) fn(i);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return seconds * 1e9 / iterations;
+}
+
+template<typename Value>
+static void RunSuite(const char* label, int iterations) {
+    // Typical reflected members: a name, an asset URL, a float and a transform
+    std::string name = "SpawnLocationNorth";
+    std::string asset = "rbxasset://textures/sky/null_plainsky512_bk.jpg";
+    double transparency = 0.25;
+    CFrame cframe(Vector3(10.0f, 4.0f, -3.0f));
+
+    double stringGet = Measure(iterations, [&](int) {
+        Value v(name);
+        gSink += v.toString().size();
+    });
+    double longGet = Measure(iterations, [&](int) {
+        Value v(asset);
+        gSink += v.toString().size();
+    });
+    double floatGet = Measure(iterations, [&](int) {
+        Value v(transparency);
+        gSink += static_cast<size_t>(v.toFloat());
+    });
+    double cframeGet = Measure(iterations, [&](int) {
+        Value v(cframe);
+        gSink += static_cast<size_t>(v.toCFrame().position.x);
+    });
+
+    std::vector<Value> batch(64, Value(name));
+    double copyBatch = Measure(iterations / 64, [&](int) {
+        std::vector<Value> copy = batch;
+        gSink += copy.size();
+    }) / 64.0;
+
+    printf("  %-8s sizeof=%3zu  string %6.1f ns  long string %6.1f ns  float %6.1f ns  cframe %6.1f ns  copy %6.1f ns\n",
+        label, sizeof(Value), stringGet, longGet, floatGet, cframeGet, copyBatch);
+}
+
+int main(int argc, char* argv[]) {
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 2000000;
+
+    printf("PropertyValue: %d iterations (ns per value)\n", iterations);
+    RunSuite<LegacyPropertyValue>("variant", iterations);
+    RunSuite<PropertyValue>("compact", iterations);
+    printf("  (checksum %zu)\n", gSink);
+    return 0;
+}
@@ -0,0 +1,49 @@
+// Nova Game Engine - PrototypeCache spawn benchmark
+// Compares parsing a model file on every spawn with stamping copies out of
+// the cached template.
+//   PrototypeCacheBench [model.rbxm] [iterations]
+
+#include "Engine/Nova.hpp"
+#include "Engine/Objects/InstanceFactory.hpp"
+#include "Engine/Reflection/ClassDescriptor.hpp"
+#include "Engine/Reflection/LevelLoader.hpp"
+#include "Engine/Reflection/PrototypeCache.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+using namespace Nova;
+
+template<typename Fn>
+static double Seconds(int iterations, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) fn();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    std::string path = argc > 1 ? argv[1] : "./resources/fonts/character.rbxm";
+    int iterations = argc > 2 ? std::atoi(argv[2]) : 1000;
+
+    RegisterClasses();
+
+    auto items = PrototypeCache::Get().Instantiate(path);
+    if (items.empty()) {
+        printf("PrototypeCache: cannot load %s\n", path.c_str());
+        return 1;
+    }
+    size_t instances = 0;
+    for (auto& item : items) instances += 1 + item->CountDescendants();
+
+    double parse = Seconds(iterations, [&] {
+        auto root = InstanceFactory::Get().Create("Model");
+        LevelLoader::Load(path, root);
+    });
+    double cached = Seconds(iterations, [&] { items = PrototypeCache::Get().Instantiate(path); });
+
+    printf("PrototypeCache: %s, %zu instances, %d iterations\n", path.c_str(), instances, iterations);
+    printf("  %-8s %10.2f us/spawn\n", "parse", parse * 1e6 / iterations);
+    printf("  %-8s %10.2f us/spawn\n", "cached", cached * 1e6 / iterations);
+    return 0;
+}
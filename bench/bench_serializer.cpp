@@ -0,0 +1,71 @@
+// Nova Game Engine - InstanceSerializer throughput benchmark
+// Encodes and decodes a welded multi-part model and reports MB/s and parts/s,
+// with Clone as the in-memory baseline for decode.
+
+#include "Engine/Nova.hpp"
+#include "Engine/Objects/InstanceFactory.hpp"
+#include "Engine/Reflection/ClassDescriptor.hpp"
+#include "Engine/Reflection/InstanceSerializer.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+
+using namespace Nova;
+
+static std::shared_ptr<Instance> BuildModel(int partCount) {
+    auto model = InstanceFactory::Get().Create("Model");
+    std::shared_ptr<Part> previous;
+    for (int i = 0; i < partCount; i++) {
+        auto part = std::static_pointer_cast<Part>(InstanceFactory::Get().Create("Part"));
+        part->SetName("Part" + std::to_string(i));
+        part->cframe.position = Vector3(float(i % 10) * 4.0f, float(i / 100) * 2.0f, float((i / 10) % 10) * 4.0f);
+        part->size = Vector3(4.0f, 1.0f, 2.0f);
+        part->brickColor = 21 + i % 8;
+        part->SetParent(model);
+
+        if (previous) {
+            auto weld = std::static_pointer_cast<Weld>(InstanceFactory::Get().Create("Weld"));
+            weld->Part0 = previous;
+            weld->Part1 = part;
+            weld->SetParent(part);
+        }
+        previous = part;
+    }
+    return model;
+}
+
+template<typename Fn>
+static double Seconds(int iterations, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) fn();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    int partCount = argc > 1 ? std::atoi(argv[1]) : 500;
+    int iterations = argc > 2 ? std::atoi(argv[2]) : 200;
+
+    RegisterClasses();
+    auto model = BuildModel(partCount);
+
+    std::vector<uint8_t> bytes = InstanceSerializer::Serialize({ model });
+    auto decoded = InstanceSerializer::Deserialize(bytes.data(), bytes.size());
+    if (decoded.size() != 1 || decoded[0]->CountDescendants() != model->CountDescendants()) {
+        printf("Serializer: round trip mismatch\n");
+        return 1;
+    }
+
+    printf("Serializer: %d parts + welds, %zu bytes, %d iterations\n", partCount, bytes.size(), iterations);
+    double mb = double(bytes.size()) * iterations / (1024.0 * 1024.0);
+    double parts = double(partCount) * iterations;
+
+    double encode = Seconds(iterations, [&] { bytes = InstanceSerializer::Serialize({ model }); });
+    double decode = Seconds(iterations, [&] { decoded = InstanceSerializer::Deserialize(bytes.data(), bytes.size()); });
+    double clone = Seconds(iterations, [&] { decoded = { model->Clone() }; });
+
+    printf("  %-8s %8.1f MB/s  %10.0f parts/s\n", "encode", mb / encode, parts / encode);
+    printf("  %-8s %8.1f MB/s  %10.0f parts/s\n", "decode", mb / decode, parts / decode);
+    printf("  %-8s %8s       %10.0f parts/s\n", "clone", "-", parts / clone);
+    return 0;
+}
@@ -0,0 +1,176 @@
+// Nova Game Engine
+// Copyright (C) 2026  brambora69123
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include "Common/MathTypes.hpp"
+
+namespace Nova {
+    // Little-endian byte stream for on-disk and in-memory encodings. Integers are
+    // LEB128 varints (signed ones zigzagged first), floats are raw 32-bit.
+    class BinaryWriter {
+    public:
+        void WriteU8(uint8_t v) { mData.push_back(v); }
+
+        void WriteVarUInt(uint64_t v) {
+            while (v >= 0x80) {
+                mData.push_back(static_cast<uint8_t>(v) | 0x80);
+                v >>= 7;
+            }
+            mData.push_back(static_cast<uint8_t>(v));
+        }
+
+        void WriteVarInt(int64_t v) {
+            WriteVarUInt((static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63));
+        }
+
+        void WriteFloat(float v) {
+            uint8_t bytes[sizeof(float)];
+            std::memcpy(bytes, &v, sizeof(float));
+            WriteBytes(bytes, sizeof(float));
+        }
+
+        void WriteString(std::string_view s) {
+            WriteVarUInt(s.size());
+            WriteBytes(reinterpret_cast<const uint8_t*>(s.data()), s.size());
+        }
+
+        void WriteVec3(const Vector3& v) {
+            WriteFloat(v.x);
+            WriteFloat(v.y);
+            WriteFloat(v.z);
+        }
+
+        void WriteCFrame(const CFrame& cf) {
+            WriteVec3(cf.position);
+            for (int i = 0; i < 3; i++) WriteVec3(cf.rotation[i]);
+        }
+
+        void WriteBytes(const uint8_t* ptr, size_t len) { mData.insert(mData.end(), ptr, ptr + len); }
+
+        // Typed write matching BinaryReader::Read; enums and integers share the varint path
+        template<typename V>
+        void Write(const V& v) {
+            if constexpr (std::is_same_v<V, bool>) WriteU8(v ? 1 : 0);
+            else if constexpr (std::is_enum_v<V>) WriteVarInt(static_cast<int64_t>(v));
+            else if constexpr (std::is_integral_v<V>) WriteVarInt(static_cast<int64_t>(v));
+            else if constexpr (std::is_floating_point_v<V>) WriteFloat(static_cast<float>(v));
+            else if constexpr (std::is_same_v<V, std::string>) WriteString(v);
+            else if constexpr (std::is_same_v<V, Vector3>) WriteVec3(v);
+            else if constexpr (std::is_same_v<V, CFrame>) WriteCFrame(v);
+            else static_assert(!sizeof(V), "type has no binary encoding");
+        }
+
+        const std::vector<uint8_t>& GetData() const { return mData; }
+        std::vector<uint8_t> TakeData() { return std::move(mData); }
+        size_t Size() const { return mData.size(); }
+        void Reserve(size_t bytes) { mData.reserve(bytes); }
+
+    private:
+        std::vector<uint8_t> mData;
+    };
+
+    // Bounds-checked reader. Running past the end (or a malformed varint) sets
+    // Failed() and yields zero values from then on, so callers check once at the end.
+    class BinaryReader {
+    public:
+        BinaryReader(const uint8_t* data, size_t len) : mData(data), mLen(len) {}
+
+        uint8_t ReadU8() {
+            if (mPos >= mLen) { Fail(); return 0; }
+            return mData[mPos++];
+        }
+
+        uint64_t ReadVarUInt() {
+            uint64_t v = 0;
+            for (int shift = 0; shift < 64; shift += 7) {
+                if (mPos >= mLen) { Fail(); return 0; }
+                uint8_t byte = mData[mPos++];
+                v |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if (!(byte & 0x80)) return v;
+            }
+            Fail();
+            return 0;
+        }
+
+        int64_t ReadVarInt() {
+            uint64_t v = ReadVarUInt();
+            return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1);
+        }
+
+        float ReadFloat() {
+            float v = 0.0f;
+            if (mPos + sizeof(float) > mLen) { Fail(); return v; }
+            std::memcpy(&v, mData + mPos, sizeof(float));
+            mPos += sizeof(float);
+            return v;
+        }
+
+        // View into the underlying buffer, valid for as long as the buffer is
+        std::string_view ReadStringView() {
+            uint64_t len = ReadVarUInt();
+            if (len > mLen - mPos) { Fail(); return std::string_view(); }
+            std::string_view s(reinterpret_cast<const char*>(mData + mPos), len);
+            mPos += len;
+            return s;
+        }
+
+        std::string ReadString() { return std::string(ReadStringView()); }
+
+        Vector3 ReadVec3() {
+            float x = ReadFloat();
+            float y = ReadFloat();
+            float z = ReadFloat();
+            return { x, y, z };
+        }
+
+        CFrame ReadCFrame() {
+            CFrame cf;
+            cf.position = ReadVec3();
+            for (int i = 0; i < 3; i++) cf.rotation[i] = ReadVec3();
+            return cf;
+        }
+
+        template<typename V>
+        void Read(V& out) {
+            if constexpr (std::is_same_v<V, bool>) out = ReadU8() != 0;
+            else if constexpr (std::is_enum_v<V> || std::is_integral_v<V>) out = static_cast<V>(ReadVarInt());
+            else if constexpr (std::is_floating_point_v<V>) out = static_cast<V>(ReadFloat());
+            else if constexpr (std::is_same_v<V, std::string>) out.assign(ReadStringView());
+            else if constexpr (std::is_same_v<V, Vector3>) out = ReadVec3();
+            else if constexpr (std::is_same_v<V, CFrame>) out = ReadCFrame();
+            else static_assert(!sizeof(V), "type has no binary encoding");
+        }
+
+        void Skip(size_t bytes) {
+            if (bytes > mLen - mPos) { Fail(); return; }
+            mPos += bytes;
+        }
+
+        bool Failed() const { return mFailed; }
+        bool HasMore() const { return mPos < mLen; }
+        size_t GetPosition() const { return mPos; }
+        size_t Remaining() const { return mLen - mPos; }
+
+    private:
+        const uint8_t* mData;
+        size_t mLen;
+        size_t mPos = 0;
+        bool mFailed = false;
+
+        void Fail() {
+            mFailed = true;
+            mPos = mLen;
+        }
+    };
+}
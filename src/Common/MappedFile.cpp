@@ -0,0 +1,124 @@
+// Nova Game Engine
+// Copyright (C) 2026  brambora69123
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+#include "Common/MappedFile.hpp"
+#include "Common/Log.hpp"
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Nova {
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            Close();
+            mData = std::exchange(other.mData, nullptr);
+            mSize = std::exchange(other.mSize, 0);
+            mCopyOnWrite = std::exchange(other.mCopyOnWrite, false);
+#ifdef _WIN32
+            mMapping = std::exchange(other.mMapping, nullptr);
+#endif
+        }
+        return *this;
+    }
+
+#ifdef _WIN32
+    bool MappedFile::Open(const std::string& path, bool copyOnWrite) {
+        Close();
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            LOG_ERR("MappedFile", "Cannot open '%s'", path.c_str());
+            return false;
+        }
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+            CloseHandle(file);
+            LOG_ERR("MappedFile", "'%s' is empty", path.c_str());
+            return false;
+        }
+
+        // The mapping keeps the file alive, so the handle can go right away
+        HANDLE mapping = CreateFileMappingA(file, nullptr, copyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (!mapping) {
+            LOG_ERR("MappedFile", "Cannot map '%s'", path.c_str());
+            return false;
+        }
+
+        void* view = MapViewOfFile(mapping, copyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+        if (!view) {
+            CloseHandle(mapping);
+            LOG_ERR("MappedFile", "Cannot map '%s'", path.c_str());
+            return false;
+        }
+
+        mMapping = mapping;
+        mData = static_cast<uint8_t*>(view);
+        mSize = static_cast<size_t>(size.QuadPart);
+        mCopyOnWrite = copyOnWrite;
+        return true;
+    }
+
+    void MappedFile::Close() {
+        if (mData) UnmapViewOfFile(mData);
+        if (mMapping) CloseHandle(mMapping);
+        mData = nullptr;
+        mMapping = nullptr;
+        mSize = 0;
+        mCopyOnWrite = false;
+    }
+#else
+    bool MappedFile::Open(const std::string& path, bool copyOnWrite) {
+        Close();
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            LOG_ERR("MappedFile", "Cannot open '%s'", path.c_str());
+            return false;
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || st.st_size == 0) {
+            ::close(fd);
+            LOG_ERR("MappedFile", "'%s' is empty", path.c_str());
+            return false;
+        }
+
+        // The mapping keeps the file alive, so the descriptor can go right away.
+        // MAP_PRIVATE makes writes copy-on-write when they are allowed at all.
+        int protection = copyOnWrite ? PROT_READ | PROT_WRITE : PROT_READ;
+        void* view = ::mmap(nullptr, static_cast<size_t>(st.st_size), protection, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (view == MAP_FAILED) {
+            LOG_ERR("MappedFile", "Cannot map '%s'", path.c_str());
+            return false;
+        }
+        ::madvise(view, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+
+        mData = static_cast<uint8_t*>(view);
+        mSize = static_cast<size_t>(st.st_size);
+        mCopyOnWrite = copyOnWrite;
+        return true;
+    }
+
+    void MappedFile::Close() {
+        if (mData) ::munmap(mData, mSize);
+        mData = nullptr;
+        mSize = 0;
+        mCopyOnWrite = false;
+    }
+#endif
+}
@@ -0,0 +1,46 @@
+// Nova Game Engine
+// Copyright (C) 2026  brambora69123
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Nova {
+    // Memory mapping of a whole file. The pages are shared with the OS file cache,
+    // so large places are read without a heap copy. A copy-on-write mapping can be
+    // modified in place through MutableData(); only the touched pages get copied
+    // and the file itself never changes.
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        explicit MappedFile(const std::string& path, bool copyOnWrite = false) { Open(path, copyOnWrite); }
+        ~MappedFile() { Close(); }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        bool Open(const std::string& path, bool copyOnWrite = false);
+        void Close();
+
+        bool IsOpen() const { return mData != nullptr; }
+        const uint8_t* Data() const { return mData; }
+        uint8_t* MutableData() { return mCopyOnWrite ? mData : nullptr; }
+        size_t Size() const { return mSize; }
+
+    private:
+        uint8_t* mData = nullptr;
+        size_t mSize = 0;
+        bool mCopyOnWrite = false;
+#ifdef _WIN32
+        void* mMapping = nullptr;
+#endif
+    };
+}
@@ -0,0 +1,53 @@
+// Nova Game Engine
+// Copyright (C) 2026  brambora69123
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Nova {
+    // Runs fn(i) for every i in [0, count) on up to one thread per core, the
+    // calling thread included, and returns once all are done. Indices are handed
+    // out one at a time so uneven items balance out. The first exception thrown
+    // by fn stops the remaining items and is rethrown on the caller.
+    template<typename Fn>
+    void ParallelFor(size_t count, Fn&& fn) {
+        size_t workers = std::min<size_t>(count, std::max(1u, std::thread::hardware_concurrency()));
+        if (workers <= 1) {
+            for (size_t i = 0; i < count; i++) fn(i);
+            return;
+        }
+
+        std::atomic<size_t> next{0};
+        std::exception_ptr error;
+        std::mutex errorMutex;
+        auto run = [&] {
+            for (size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < count;) {
+                try {
+                    fn(i);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (!error) error = std::current_exception();
+                    next.store(count, std::memory_order_relaxed);
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(workers - 1);
+        for (size_t t = 1; t < workers; t++) threads.emplace_back(run);
+        run();
+        for (auto& thread : threads) thread.join();
+        if (error) std::rethrow_exception(error);
+    }
+}
@@ -7,51 +7,66 @@
 // (at your option) any later version.
 
 #pragma once
+#include <atomic>
 #include <string>
-#include <variant>
-#include <optional>
+#include <string_view>
 #include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
 #include "Common/MathTypes.hpp"
 
 namespace Nova {
-    // Wrapper types to distinguish Vector3 and Color3 in variant
-    struct Color3Value {
-        float r, g, b;
-        Color3Value() : r(1), g(1), b(1) {}
-        Color3Value(float r, float g, float b) : r(r), g(g), b(b) {}
-        Color3Value(const Color3& c) : r(c.r), g(c.g), b(c.b) {}
-        Color3 to_glm() const { return Color3(r, g, b); }
-    };
-
+    // Tagged value for reflected get/set, 32 bytes. Strings of up to
+    // InlineStringCapacity bytes live in the payload and never allocate. Longer
+    // ones take one allocation, a refcounted header followed by the characters,
+    // which copies share and the last copy frees. CFrames are stored as
+    // position + quaternion, and wide scalars go through memcpy so the payload
+    // only needs 4-byte alignment.
     struct PropertyValue {
-        enum class Kind { Nil, Bool, Int, Float, String, Vector3, CFrame, Color3 };
-
-        using Storage = std::variant<
-            std::nullopt_t,
-            bool,
-            int64_t,
-            double,
-            std::string,
-            Vector3,
-            CFrame,
-            Color3Value
-        >;
-
-        Storage storage;
-        Kind kind;
-
-        PropertyValue() : storage(std::nullopt), kind(Kind::Nil) {}
-        PropertyValue(bool v) : storage(v), kind(Kind::Bool) {}
-        PropertyValue(int64_t v) : storage(v), kind(Kind::Int) {}
-        PropertyValue(int v) : storage(static_cast<int64_t>(v)), kind(Kind::Int) {}
-        PropertyValue(double v) : storage(v), kind(Kind::Float) {}
-        PropertyValue(float v) : storage(static_cast<double>(v)), kind(Kind::Float) {}
-        PropertyValue(const std::string& v) : storage(v), kind(Kind::String) {}
-        PropertyValue(const char* v) : storage(std::string(v)), kind(Kind::String) {}
-        PropertyValue(const Vector3& v) : storage(v), kind(Kind::Vector3) {}
-        PropertyValue(const CFrame& v) : storage(v), kind(Kind::CFrame) {}
+        // Values are part of the wire format
+        enum class Kind : uint8_t { Nil, Bool, Int, Float, String, Vector3, CFrame, Color3 };
+
+        Kind kind = Kind::Nil;
+
+        PropertyValue() = default;
+        PropertyValue(bool v) : kind(Kind::Bool) { Put(v); }
+        PropertyValue(int64_t v) : kind(Kind::Int) { Put(v); }
+        PropertyValue(int v) : kind(Kind::Int) { Put(static_cast<int64_t>(v)); }
+        PropertyValue(double v) : kind(Kind::Float) { Put(v); }
+        PropertyValue(float v) : kind(Kind::Float) { Put(static_cast<double>(v)); }
+        PropertyValue(std::string_view v) : kind(Kind::String) { PutString(v); }
+        PropertyValue(const std::string& v) : PropertyValue(std::string_view(v)) {}
+        PropertyValue(const char* v) : PropertyValue(std::string_view(v)) {}
+        PropertyValue(const Vector3& v) : kind(Kind::Vector3) { Put(v); }
+        PropertyValue(const CFrame& v) : kind(Kind::CFrame) {
+            Put(PackedCFrame{ v.position, glm::quat_cast(v.rotation) });
+        }
+        PropertyValue(const PropertyValue& other) { CopyFrom(other); }
+        PropertyValue(PropertyValue&& other) noexcept { StealFrom(other); }
+        PropertyValue& operator=(const PropertyValue& other) {
+            if (this != &other) {
+                Release();
+                CopyFrom(other);
+            }
+            return *this;
+        }
+        PropertyValue& operator=(PropertyValue&& other) noexcept {
+            if (this != &other) {
+                Release();
+                StealFrom(other);
+            }
+            return *this;
+        }
+        ~PropertyValue() { Release(); }
+
         // Color3 must be constructed via the static factory to avoid ambiguity with Vector3
-        static PropertyValue FromColor3(const Color3& v) { return PropertyValue(Color3Value(v), Kind::Color3); }
+        static PropertyValue FromColor3(const Color3& v) {
+            PropertyValue value;
+            value.kind = Kind::Color3;
+            value.Put(v);
+            return value;
+        }
 
         bool isNil() const { return kind == Kind::Nil; }
         bool isBool() const { return kind == Kind::Bool; }
@@ -63,19 +78,109 @@ namespace Nova {
         bool isCFrame() const { return kind == Kind::CFrame; }
         bool isColor3() const { return kind == Kind::Color3; }
 
-        bool toBool() const { return std::get<bool>(storage); }
-        int64_t toInt() const { return std::get<int64_t>(storage); }
-        double toFloat() const { return std::get<double>(storage); }
+        // Accessors return a zero value on a kind mismatch
+        bool toBool() const { return kind == Kind::Bool && Take<bool>(); }
+        int64_t toInt() const { return kind == Kind::Int ? Take<int64_t>() : 0; }
+        double toFloat() const { return kind == Kind::Float ? Take<double>() : 0.0; }
         double toNumber() const {
-            if (kind == Kind::Int) return static_cast<double>(std::get<int64_t>(storage));
-            return std::get<double>(storage);
+            if (kind == Kind::Int) return static_cast<double>(Take<int64_t>());
+            return toFloat();
+        }
+        // Valid while this value (or a copy sharing its buffer) is alive
+        std::string_view toString() const {
+            if (kind != Kind::String) return {};
+            if (mData[0] != BoxedString) return std::string_view(reinterpret_cast<const char*>(mData + 1), mData[0]);
+            const StringBox* box = TakeBox();
+            return std::string_view(box->Chars(), box->size);
         }
-        const std::string& toString() const { return std::get<std::string>(storage); }
-        const Vector3& toVector3() const { return std::get<Vector3>(storage); }
-        const CFrame& toCFrame() const { return std::get<CFrame>(storage); }
-        Color3 toColor3() const { return std::get<Color3Value>(storage).to_glm(); }
+        Vector3 toVector3() const { return kind == Kind::Vector3 ? Take<Vector3>() : Vector3(0.0f); }
+        CFrame toCFrame() const {
+            if (kind != Kind::CFrame) return CFrame();
+            auto packed = Take<PackedCFrame>();
+            return CFrame(packed.position, glm::mat3_cast(packed.rotation));
+        }
+        Color3 toColor3() const { return kind == Kind::Color3 ? Take<Color3>() : Color3(1.0f); }
+
+        static constexpr size_t InlineStringCapacity = 27;
 
     private:
-        PropertyValue(Color3Value v, Kind k) : storage(v), kind(k) {}
+        // Header of a long string's block; the characters follow it
+        struct StringBox {
+            std::atomic<uint32_t> refs;
+            size_t size;
+            const char* Chars() const { return reinterpret_cast<const char*>(this + 1); }
+            char* Chars() { return reinterpret_cast<char*>(this + 1); }
+        };
+
+        // First payload byte of a string: its length, or this marker when the
+        // payload holds a StringBox pointer at BoxOffset instead
+        static constexpr unsigned char BoxedString = 0xFF;
+        static constexpr size_t BoxOffset = 4;
+
+        struct PackedCFrame {
+            Vector3 position;
+            glm::quat rotation;
+        };
+
+        alignas(4) unsigned char mData[28] = {};
+
+        template<typename V>
+        void Put(const V& v) {
+            static_assert(sizeof(V) <= sizeof(mData) && std::is_trivially_copyable_v<V>);
+            std::memcpy(mData, &v, sizeof(V));
+        }
+
+        template<typename V>
+        V Take() const {
+            V v;
+            std::memcpy(&v, mData, sizeof(V));
+            return v;
+        }
+
+        void PutString(std::string_view v) {
+            if (v.size() <= InlineStringCapacity) {
+                mData[0] = static_cast<unsigned char>(v.size());
+                std::memcpy(mData + 1, v.data(), v.size());
+                return;
+            }
+            void* block = ::operator new(sizeof(StringBox) + v.size());
+            StringBox* box = new (block) StringBox{ 1, v.size() };
+            std::memcpy(box->Chars(), v.data(), v.size());
+            mData[0] = BoxedString;
+            std::memcpy(mData + BoxOffset, &box, sizeof(box));
+        }
+
+        StringBox* TakeBox() const {
+            StringBox* box;
+            std::memcpy(&box, mData + BoxOffset, sizeof(box));
+            return box;
+        }
+
+        bool HoldsBox() const { return kind == Kind::String && mData[0] == BoxedString; }
+
+        void CopyFrom(const PropertyValue& other) {
+            kind = other.kind;
+            std::memcpy(mData, other.mData, sizeof(mData));
+            if (HoldsBox()) TakeBox()->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void StealFrom(PropertyValue& other) {
+            kind = other.kind;
+            std::memcpy(mData, other.mData, sizeof(mData));
+            other.kind = Kind::Nil;
+        }
+
+        void Release() {
+            if (HoldsBox()) {
+                StringBox* box = TakeBox();
+                if (box->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    box->~StringBox();
+                    ::operator delete(box);
+                }
+            }
+            kind = Kind::Nil;
+        }
     };
+
+    static_assert(sizeof(PropertyValue) <= 32, "PropertyValue must stay within 32 bytes");
 }
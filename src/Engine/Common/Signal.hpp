@@ -28,17 +28,37 @@ namespace Nova {
         struct LuaConnection : public std::enable_shared_from_this<LuaConnection> {
             luabridge::LuaRef callback;
             bool connected = true;
+            Signal* owner = nullptr;  // Cleared when the signal dies first
 
             LuaConnection(luabridge::LuaRef cb) : callback(cb) {}
-            void Disconnect() { connected = false; }
+            void Disconnect() {
+                if (!connected) return;
+                connected = false;
+                if (owner) owner->OnDisconnected();
+            }
         };
 
+        // Called with true when the first live connection arrives and with
+        // false when the last one is disconnected
+        std::function<void(bool)> onListenersChanged;
+
+        Signal() = default;
+        Signal(const Signal&) = delete;
+        Signal& operator=(const Signal&) = delete;
+        ~Signal() {
+            for (auto& conn : connections) conn->owner = nullptr;
+        }
+
         std::shared_ptr<LuaConnection> connect(luabridge::LuaRef callback) {
             auto conn = std::make_shared<LuaConnection>(callback);
+            conn->owner = this;
             connections.push_back(conn);
+            if (++liveCount == 1 && onListenersChanged) onListenersChanged(true);
             return conn;
         }
 
+        bool HasListeners() const { return liveCount > 0; }
+
         template<typename... Args>
         void fire(Args&&... args) {
             for (auto it = connections.begin(); it != connections.end();) {
@@ -57,5 +77,10 @@ namespace Nova {
 
     private:
         std::vector<std::shared_ptr<LuaConnection>> connections;
+        size_t liveCount = 0;
+
+        void OnDisconnected() {
+            if (--liveCount == 0 && onListenersChanged) onListenersChanged(false);
+        }
     };
 }
@@ -12,6 +12,7 @@
 #include "Engine/Reflection/LevelLoader.hpp"
 #include "Engine/Nova.hpp"
 #include "Engine/Reflection/ClassDescriptor.hpp"
+#include "Engine/Objects/InstancePool.hpp"
 #include "Common/Log.hpp"
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
@@ -81,7 +82,7 @@ namespace Nova {
         // Make sure Workspace has a Camera
         auto workspace = dataModel->GetService<Workspace>();
         if (!workspace->CurrentCamera) {
-            auto camera = std::make_shared<Camera>();
+            auto camera = MakePooled<Camera>();
             camera->SetParent(workspace);
             workspace->CurrentCamera = camera;
         }
@@ -111,6 +112,26 @@ namespace Nova {
         SetupDefaultLighting();
     }
 
+    bool Engine::SaveCheckpoint(const std::string& path) {
+        return checkpoint.Save(*dataModel, path);
+    }
+
+    void Engine::EnableAutosave(const std::string& path, double intervalSeconds) {
+        // Clients only mirror the server's world; there is nothing of their own to save
+        if (mode == Mode::Client || intervalSeconds <= 0.0) return;
+
+        scheduler->AddJob({
+            .name = "Autosave",
+            .callback = [this, path](double dt) {
+                (void)dt;
+                SaveCheckpoint(path);
+            },
+            .priority = 200,
+            .frequency = 1.0 / intervalSeconds
+        });
+        LOG_INF("Engine", "Autosaving to '%s' every %.0f s.", path.c_str(), intervalSeconds);
+    }
+
     void Engine::SetupDefaultLighting() {
         auto lighting = dataModel->GetService<Lighting>();
         if (lighting->ClearColor.r == 0.0f || (lighting->ClearColor.r == 1.0f && lighting->ClearColor.g == 1.0f)) {
@@ -128,7 +149,7 @@ namespace Nova {
             }
         }
         if (!hasSky) {
-            auto sky = std::make_shared<Sky>();
+            auto sky = MakePooled<Sky>();
             sky->SetParent(lighting);
             LOG_INF("Engine", "Added default Sky instance.");
         }
@@ -226,6 +247,8 @@ namespace Nova {
     }
 
     void Engine::Shutdown() {
+        // A checkpoint still being written finishes before anything is torn down
+        checkpoint.Wait();
         if (renderer) {
             renderer.reset();
         }
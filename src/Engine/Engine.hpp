@@ -10,6 +10,7 @@
 
 #include "Engine/TaskScheduler.hpp"
 #include "Engine/Services/DataModel.hpp"
+#include "Engine/Reflection/Checkpoint.hpp"
 #include <memory>
 #include <string>
 
@@ -37,7 +38,12 @@ namespace Nova {
         // Client: window + renderer, no simulation, network client
         bool InitializeClient(const std::string& host, uint16_t port);
 
+        // Accepts .rbxl XML, binary places and checkpoints
         void LoadLevel(const std::string& path);
+        // Snapshots the world now and writes it in the background; see Checkpoint
+        bool SaveCheckpoint(const std::string& path);
+        // Saves a checkpoint to path every intervalSeconds while running
+        void EnableAutosave(const std::string& path, double intervalSeconds);
         void Run();
         void Shutdown();
 
@@ -54,6 +60,7 @@ namespace Nova {
         std::unique_ptr<TaskScheduler> scheduler;
         std::unique_ptr<Renderer> renderer;
         std::shared_ptr<DataModel> dataModel;
+        Checkpoint checkpoint;
 
         Mode mode = Mode::PlaySolo;
         bool running = false;
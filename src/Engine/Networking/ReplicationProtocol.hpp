@@ -14,6 +14,7 @@
 #include <cstring>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <variant>
 
 namespace Nova {
@@ -97,7 +98,7 @@ namespace Nova {
             memcpy(&bits, &v, sizeof(float));
             WriteU32(bits);
         }
-        void WriteString(const std::string& s) {
+        void WriteString(std::string_view s) {
             WriteU16(static_cast<uint16_t>(s.size()));
             data.insert(data.end(), s.begin(), s.end());
         }
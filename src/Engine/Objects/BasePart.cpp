@@ -16,7 +16,9 @@
 
 namespace Nova {
     BasePart::~BasePart() {
-        if (!physicsBodyID.IsInvalid()) {
+        // Releasing the slot takes the maps lock, so a physics thread that resolved
+        // this part's handle finishes with it before the members go away
+        if (IsPhysicsRegistered()) {
             if (auto physics = registeredService.lock()) {
                 physics->UnregisterPart(this);
             } else if (auto dm = GetDataModel()) {
@@ -27,10 +29,6 @@ namespace Nova {
         }
     }
 
-    void BasePart::InitializePhysics() {
-        // CFrame is now a direct member, no conversion needed
-    }
-
     void BasePart::BreakJoints() {
         std::vector<std::shared_ptr<Instance>> toRemove;
         for (auto& child : children) {
@@ -46,34 +44,58 @@ namespace Nova {
     void BasePart::OnAncestorChanged(std::shared_ptr<Instance> instance, std::shared_ptr<Instance> newParent) {
         Instance::OnAncestorChanged(instance, newParent);
 
-        auto dm = GetDataModel();
-        if (dm) {
-            auto workspace = dm->GetService<Workspace>();
-            if (IsDescendantOf(workspace)) {
-                auto physics = dm->GetService<PhysicsService>();
-                if (physicsBodyID.IsInvalid()) {
-                    physics->BulkRegisterParts({ std::static_pointer_cast<BasePart>(shared_from_this()) });
-                    if (!physics->IsDeferring()) InitializePhysics();
-                }
-            } else {
-                if (!physicsBodyID.IsInvalid()) {
-                    if (auto physics = registeredService.lock()) {
-                        physics->UnregisterPart(this);
-                    } else if (auto p = dm->GetService<PhysicsService>()) {
-                        p->UnregisterPart(this);
-                    }
+        if (IsInWorkspace()) {
+            if (!IsPhysicsRegistered()) {
+                auto self = std::static_pointer_cast<BasePart>(shared_from_this());
+                auto dm = GetDataModel();
+                if (dm->IsBatching()) {
+                    dm->QueuePartRegister(std::move(self));
+                } else {
+                    dm->GetService<PhysicsService>()->BulkRegisterParts({ std::move(self) });
                 }
             }
-        } else {
-            if (!physicsBodyID.IsInvalid()) {
-                if (auto physics = registeredService.lock()) {
+        } else if (IsPhysicsRegistered()) {
+            if (auto physics = registeredService.lock()) {
+                // The part may have left the DataModel already; batch on the physics owner's
+                auto dm = physics->GetDataModel();
+                if (dm && dm->IsBatching()) {
+                    dm->QueuePartUnregister(std::static_pointer_cast<BasePart>(shared_from_this()));
+                } else {
                     physics->UnregisterPart(this);
                 }
+            } else if (auto dm = GetDataModel()) {
+                if (auto p = dm->GetService<PhysicsService>()) {
+                    p->UnregisterPart(this);
+                }
+            }
+        }
+    }
+
+    void BasePart::OnDestroying(DestroyBatch& batch) {
+        if (batch.workspace) batch.workspace->UnregisterPart(this);
+        if (IsPhysicsRegistered()) {
+            auto physics = registeredService.lock();
+            if (!batch.physics) batch.physics = physics;
+            if (physics == batch.physics) {
+                batch.parts.push_back(this);
+            } else if (physics) {
+                physics->UnregisterPart(this);
             }
         }
     }
 
+    void BasePart::SyncHotState() {
+        if (registeredWorkspace) registeredWorkspace->partStore.Write(workspaceIndex, *this);
+    }
+
+    void BasePart::SetCFrame(const CFrame& value) {
+        cframe = value;
+        if (registeredWorkspace) registeredWorkspace->partStore.cframes[workspaceIndex] = value;
+        NotifyPropertyChanged("CFrame");
+    }
+
     void BasePart::OnPropertyChanged(const std::string& name) {
+        SyncHotState();
         if (physicsBodyID.IsInvalid()) return;
 
         auto physics = registeredService.lock();
@@ -12,12 +12,14 @@
 #include "Engine/Objects/Instance.hpp"
 #include "Common/BrickColors.hpp"
 #include "Engine/Common/Signal.hpp"
+#include "Engine/Physics/PartHandle.hpp"
 #include <optional>
 #include <Jolt/Jolt.h>
 #include <Jolt/Physics/Body/BodyID.h>
 
 namespace Nova {
     class PhysicsService;
+    class Workspace;
 
     class BasePart : public Instance {
     public:
@@ -49,13 +51,21 @@ namespace Nova {
         // Jolt Physics linkage
         JPH::BodyID physicsBodyID;
         std::weak_ptr<PhysicsService> registeredService;
+        PartHandle physicsHandle;  // Slot in the physics part table, guarded by its mMapsMutex
+
+        // True from BulkRegisterParts until unregistration, including before the body exists
+        bool IsPhysicsRegistered() const { return physicsHandle.IsValid() || !physicsBodyID.IsInvalid(); }
+
+        // Slot in Workspace::cachedParts, or InvalidWorkspaceIndex when not under a Workspace
+        static constexpr uint32_t InvalidWorkspaceIndex = UINT32_MAX;
+        uint32_t workspaceIndex = InvalidWorkspaceIndex;
+        Workspace* registeredWorkspace = nullptr;  // Owner of workspaceIndex, set by Workspace::RegisterPart
 
         virtual ~BasePart();
 
         BasePart(std::string name) : Instance(name) {}
         BasePart() : Instance("BasePart") {}
 
-        void InitializePhysics();
 
         virtual glm::mat4 GetLocalTransform() {
             return cframe.to_mat4();
@@ -95,8 +105,18 @@ namespace Nova {
         void SetVelocity(const glm::vec3& velocity);
 
         void OnAncestorChanged(std::shared_ptr<Instance> instance, std::shared_ptr<Instance> newParent) override;
+        void OnDestroying(DestroyBatch& batch) override;
         void OnPropertyChanged(const std::string& name) override;
 
+        // Mirrors the hot fields into the Workspace PartStore. Reflected writes get this
+        // through OnPropertyChanged; engine code writing the members directly must call it.
+        void SyncHotState();
+
+        // Code-side transform write: updates the member, the PartStore and listeners
+        void SetCFrame(const CFrame& value);
+
+        // CFrame change notifications fire from UpdateNetworkInterpolation, once per
+        // frame while the part moves, so handlers read the value being applied
         void SetNetworkTargetCFrame(const CFrame& target) {
             networkPrevCFrame = cframe;
             networkTargetCFrame = target;
@@ -107,13 +127,13 @@ namespace Nova {
             if (networkLerpAlpha >= 1.0f) return;
             networkLerpAlpha = std::min(1.0f, networkLerpAlpha + dt * NETWORK_LERP_SPEED);
             float t = networkLerpAlpha;
-            cframe.position = glm::mix(networkPrevCFrame.position, networkTargetCFrame.position, t);
             glm::quat q0 = glm::quat_cast(networkPrevCFrame.rotation);
             glm::quat q1 = glm::quat_cast(networkTargetCFrame.rotation);
-            cframe.rotation = glm::mat3_cast(glm::slerp(q0, q1, t));
+            SetCFrame(CFrame(glm::mix(networkPrevCFrame.position, networkTargetCFrame.position, t),
+                             glm::mat3_cast(glm::slerp(q0, q1, t))));
         }
 
         std::string GetClassName() const override { return "BasePart"; }
-        std::string GetName() const override { return m_debugName; }
+        const std::string& GetName() const override { return m_debugName; }
     };
 }
@@ -26,6 +26,6 @@ namespace Nova {
         }
 
         std::string GetClassName() const override { return "Camera"; }
-        std::string GetName() const override { return m_debugName; }
+        const std::string& GetName() const override { return m_debugName; }
     };
 }
@@ -24,20 +24,20 @@ namespace Nova {
 
         LOG_DBG("Explosion", "OnAncestorChanged, parent=%s", newParent ? newParent->GetName().c_str() : "nil");
 
-        auto dm = GetDataModel();
-        if (dm) {
-            auto workspace = dm->GetService<Workspace>();
-            if (IsDescendantOf(workspace)) {
-                if (auto physics = dm->GetService<PhysicsService>()) {
-                    physics->QueueExplosion(position, BlastRadius, BlastPressure);
-
-                    m_visualActive = true;
-                    m_visualTime = 0.0f;
-                }
-            }
+        if (!IsInWorkspace()) return;
+        if (auto physics = GetDataModel()->GetService<PhysicsService>()) {
+            physics->QueueExplosion(position, BlastRadius, BlastPressure);
+
+            m_visualActive = true;
+            m_visualTime = 0.0f;
         }
     }
 
+    void Explosion::OnDestroying(DestroyBatch& batch) {
+        // The finished effect would otherwise reparent a destroyed instance
+        m_visualActive = false;
+    }
+
     void Explosion::UpdateVisual(float dt) {
         if (!m_visualActive) return;
 
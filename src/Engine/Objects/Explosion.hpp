@@ -31,8 +31,9 @@ namespace Nova {
         Explosion();
 
         void OnAncestorChanged(std::shared_ptr<Instance> instance, std::shared_ptr<Instance> newParent) override;
+        void OnDestroying(DestroyBatch& batch) override;
 
         std::string GetClassName() const override { return "Explosion"; }
-        std::string GetName() const override { return m_debugName; }
+        const std::string& GetName() const override { return m_debugName; }
     };
 }
@@ -8,6 +8,7 @@
 
 #include "Engine/Objects/Humanoid.hpp"
 #include "Engine/Services/PhysicsService.hpp"
+#include "Engine/Objects/InstancePool.hpp"
 #include "Common/Log.hpp"
 #include <Jolt/Physics/Body/BodyCreationSettings.h>
 #include <Jolt/Physics/Collision/Shape/BoxShape.h>
@@ -30,12 +31,12 @@ namespace Nova {
 
     Humanoid::Humanoid() : Instance("Humanoid") {
         // Create body parts
-        headPart = std::make_shared<Part>("Head");
-        torsoPart = std::make_shared<Part>("HumanoidRootPart");
-        leftArmPart = std::make_shared<Part>("Left Arm");
-        rightArmPart = std::make_shared<Part>("Right Arm");
-        leftLegPart = std::make_shared<Part>("Left Leg");
-        rightLegPart = std::make_shared<Part>("Right Leg");
+        headPart = MakePooled<Part>("Head");
+        torsoPart = MakePooled<Part>("HumanoidRootPart");
+        leftArmPart = MakePooled<Part>("Left Arm");
+        rightArmPart = MakePooled<Part>("Right Arm");
+        leftLegPart = MakePooled<Part>("Left Leg");
+        rightLegPart = MakePooled<Part>("Right Leg");
 
         // Set R6 sizes
         torsoPart->size = {2.0f, 2.0f, 1.0f};
@@ -148,6 +149,8 @@ namespace Nova {
         // Legs below torso
         leftLegPart->cframe.position = spawnPosition + Vector3(-0.5f, -2.0f, 0);
         rightLegPart->cframe.position = spawnPosition + Vector3(0.5f, -2.0f, 0);
+
+        ForEachPart([](auto& part) { part->SyncHotState(); });
     }
 
     void Humanoid::CreateJoints() {
@@ -457,9 +460,8 @@ namespace Nova {
             JPH::RVec3 pos = bi.GetPosition(part->physicsBodyID);
             JPH::Quat rot = bi.GetRotation(part->physicsBodyID);
 
-            part->cframe.position = {pos.GetX(), pos.GetY(), pos.GetZ()};
-            part->cframe.rotation = glm::mat3_cast(
-                glm::quat(rot.GetW(), rot.GetX(), rot.GetY(), rot.GetZ()));
+            part->SetCFrame(CFrame(glm::vec3(pos.GetX(), pos.GetY(), pos.GetZ()),
+                glm::mat3_cast(glm::quat(rot.GetW(), rot.GetX(), rot.GetY(), rot.GetZ()))));
         };
 
         ForEachPart(syncPart);
@@ -39,7 +39,7 @@ namespace Nova {
         ~Humanoid();
 
         std::string GetClassName() const override { return "Humanoid"; }
-        std::string GetName() const override { return m_debugName; }
+        const std::string& GetName() const override { return m_debugName; }
 
         // Methods
         void TakeDamage(float amount);
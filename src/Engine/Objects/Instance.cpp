@@ -8,25 +8,17 @@
 
 #include "Engine/Objects/Instance.hpp"
 #include "Engine/Objects/BasePart.hpp"
+#include "Engine/Objects/JointInstance.hpp"
 #include "Engine/Objects/InstanceFactory.hpp"
-#include "Engine/Reflection/TypeMarshaling.hpp"
+#include "Engine/Objects/InstancePool.hpp"
 #include "Engine/Reflection/ClassDescriptor.hpp"
 #include "Engine/Services/DataModel.hpp"
 #include "Engine/Services/Workspace.hpp"
 #include "Engine/Services/NetworkService.hpp"
+#include "Engine/Services/PhysicsService.hpp"
 #include "Common/Log.hpp"
 
 namespace Nova {
-    std::shared_ptr<DataModel> Instance::GetDataModel() {
-        if (auto dm = std::dynamic_pointer_cast<DataModel>(shared_from_this())) {
-            return dm;
-        }
-        if (auto p = parent.lock()) {
-            return p->GetDataModel();
-        }
-        return nullptr;
-    }
-
     bool Instance::IsDescendantOf(std::shared_ptr<Instance> other) {
         if (!other) return false;
         if (other.get() == this) return false;
@@ -41,33 +33,163 @@ namespace Nova {
     void Instance::SetParent(std::shared_ptr<Instance> newParent) {
         auto self = shared_from_this();
 
-        std::shared_ptr<Workspace> oldWS = nullptr;
-        if (auto dm = GetDataModel()) oldWS = dm->GetService<Workspace>();
-        bool wasInWS = oldWS && (this == oldWS.get() || IsDescendantOf(oldWS));
+        DataModel* oldDM = m_dataModel;
+        Workspace* oldWS = m_inWorkspace && oldDM ? oldDM->FindService<Workspace>() : nullptr;
 
-        if (auto p = parent.lock()) {
-            auto& c = p->children;
-            c.erase(std::remove(c.begin(), c.end(), self), c.end());
-        }
+        DataModel* dm = newParent ? newParent->m_dataModel : nullptr;
+        Workspace* ws = dm ? dm->FindService<Workspace>() : nullptr;
+        bool inWS = ws && (newParent->m_inWorkspace || newParent.get() == ws);
+        Workspace* newWS = inWS ? ws : nullptr;
+
+        // Side effects of the whole subtree flush once, when the outermost batch ends
+        DataModel::BatchScope oldBatch(oldDM);
+        DataModel::BatchScope newBatch(dm != oldDM ? dm : nullptr);
+
+        if (oldWS && oldWS != newWS) oldWS->OnDescendantRemoving(self);
+
+        DetachFromParent();
 
         parent = newParent;
         if (newParent) {
             newParent->children.push_back(self);
+            if (newParent->m_childIndex) {
+                newParent->m_childIndex->try_emplace(GetName(), newParent->children.size() - 1);
+            }
+            newParent->OnChildAdded(self);
         }
 
+        UpdateAncestry(dm, inWS);
+
         OnAncestorChanged(self, newParent);
 
-        if (wasInWS && oldWS) oldWS->RefreshCachedParts();
+        if (newWS && newWS != oldWS) {
+            newWS->OnDescendantAdded(self);
+            dm->QueueReplication(self);
+        } else if (dm && dm != oldDM && dm->FindService<Workspace>() == this) {
+            // The Workspace itself joined a DataModel; its contents enter the world with it
+            static_cast<Workspace*>(this)->OnDescendantAdded(self);
+            for (auto& child : children) dm->QueueReplication(child);
+        }
+    }
 
-        if (newParent) {
-            if (auto dm = newParent->GetDataModel()) {
-                if (auto newWS = dm->GetService<Workspace>()) {
-                    if (this == newWS.get() || IsDescendantOf(newWS)) {
-                        newWS->RefreshCachedParts();
-                    }
-                }
+    void Instance::DetachSilently() {
+        if (m_inWorkspace && m_dataModel) {
+            if (auto* ws = m_dataModel->FindService<Workspace>()) ws->OnDescendantRemoving(shared_from_this());
+        }
+        DetachFromParent();
+        UpdateAncestry(nullptr, false);
+    }
+
+    void Instance::DetachFromParent() {
+        auto p = parent.lock();
+        if (!p) return;
+
+        auto& c = p->children;
+        c.erase(std::remove_if(c.begin(), c.end(), [this](const std::shared_ptr<Instance>& child) {
+            return child.get() == this;
+        }), c.end());
+        p->m_childIndex.reset();
+        p->OnChildRemoved(this);
+        parent.reset();
+    }
+
+    void Instance::UpdateAncestry(DataModel* dataModel, bool inWorkspace) {
+        m_dataModel = dataModel;
+        m_inWorkspace = inWorkspace;
+
+        Workspace* ws = dataModel ? dataModel->FindService<Workspace>() : nullptr;
+        bool childrenInWS = inWorkspace || (ws && ws == this);
+        for (auto& child : children) {
+            child->UpdateAncestry(dataModel, childrenInWS);
+        }
+    }
+
+    void Instance::DetachDescendantsFromDataModel() {
+        for (auto& child : children) {
+            child->UpdateAncestry(nullptr, false);
+        }
+    }
+
+    void Instance::SetName(const std::string& name) {
+        if (auto p = parent.lock()) p->m_childIndex.reset();
+        m_debugName = name;
+    }
+
+    std::shared_ptr<Instance> Instance::FindChildByName(std::string_view name) {
+        if (children.size() < ChildIndexThreshold) {
+            for (auto& child : children) {
+                if (child->GetName() == name) return child;
             }
+            return nullptr;
         }
+
+        if (!m_childIndex) {
+            m_childIndex = std::make_unique<std::unordered_map<std::string_view, size_t>>();
+            m_childIndex->reserve(children.size());
+            for (size_t i = 0; i < children.size(); i++) {
+                m_childIndex->try_emplace(children[i]->GetName(), i);
+            }
+        }
+
+        auto it = m_childIndex->find(name);
+        return it != m_childIndex->end() ? children[it->second] : nullptr;
+    }
+
+    Signal* Instance::GetChangedSignal() {
+        return &GetPropertySignals().changed;
+    }
+
+    Signal* Instance::GetPropertyChangedSignal(const std::string& name) {
+        auto* desc = GetDescriptor();
+        PropertyID id = desc ? desc->FindPropertyID(name) : InvalidPropertyID;
+        if (id == InvalidPropertyID) {
+            LOG_WRN("Instance", "%s is not a valid property name of %s", name.c_str(), GetClassName().c_str());
+            return nullptr;
+        }
+
+        auto& signal = GetPropertySignals().byProperty[id];
+        if (!signal) {
+            signal = std::make_unique<Signal>();
+            signal->onListenersChanged = [this](bool) { RecomputeChangedMask(); };
+        }
+        return signal.get();
+    }
+
+    Instance::PropertySignals& Instance::GetPropertySignals() {
+        if (!m_propertySignals) {
+            m_propertySignals = std::make_unique<PropertySignals>();
+            m_propertySignals->changed.onListenersChanged = [this](bool) { RecomputeChangedMask(); };
+        }
+        return *m_propertySignals;
+    }
+
+    void Instance::RecomputeChangedMask() {
+        if (m_destroyed) return;
+        if (m_propertySignals->changed.HasListeners()) {
+            m_changedMask = ~uint64_t(0);
+            return;
+        }
+        uint64_t mask = 0;
+        for (auto& [id, signal] : m_propertySignals->byProperty) {
+            if (signal->HasListeners()) mask |= PropertyBit(id);
+        }
+        m_changedMask = mask;
+    }
+
+    void Instance::FirePropertyChanged(PropertyID id) {
+        auto* desc = GetDescriptor();
+        if (!m_propertySignals || !desc || id >= desc->flatProperties.size()) return;
+
+        // A handler may drop the last reference to this instance
+        auto self = shared_from_this();
+        if (auto it = m_propertySignals->byProperty.find(id); it != m_propertySignals->byProperty.end()) {
+            it->second->fire();
+        }
+        m_propertySignals->changed.fire(desc->flatProperties[id].name);
+    }
+
+    void Instance::NotifyPropertyChangedByName(const std::string& name) {
+        if (auto* desc = GetDescriptor()) NotifyPropertyChanged(desc->FindPropertyID(name));
     }
 
     void Instance::OnAncestorChanged(std::shared_ptr<Instance> instance, std::shared_ptr<Instance> newParent) {
@@ -76,76 +198,95 @@ namespace Nova {
         }
     }
 
+    // View of a string key; the LuaRef keeps the interned Lua string alive
+    static std::string_view LuaKeyView(const luabridge::LuaRef& key, lua_State* L) {
+        luabridge::push(L, key);
+        size_t len = 0;
+        const char* str = lua_tolstring(L, -1, &len);
+        lua_pop(L, 1);
+        return std::string_view(str, len);
+    }
+
+    // Bound method closure: upvalues are the instance and its MethodDescriptor
+    static int LuaCallMethod(lua_State* L) {
+        auto* inst = static_cast<Instance*>(lua_tolightuserdata(L, lua_upvalueindex(1)));
+        auto* method = static_cast<const MethodDescriptor*>(lua_tolightuserdata(L, lua_upvalueindex(2)));
+        return method->call(L, inst);
+    }
+
     luabridge::LuaRef Instance::LuaIndex(Instance& self, const luabridge::LuaRef& key, lua_State* L) {
         if (!key.isString()) return luabridge::LuaRef(L);
-        std::string skey = key.unsafe_cast<std::string>();
+        std::string_view skey = LuaKeyView(key, L);
 
         // 1. Special cases
         if (skey == "Name") return luabridge::LuaRef(L, self.GetName());
         if (skey == "Parent") return luabridge::LuaRef(L, self.GetParent());
         if (skey == "ClassName") return luabridge::LuaRef(L, self.GetClassName());
+        if (skey == "Changed") return luabridge::LuaRef(L, self.GetChangedSignal());
+
+        auto* desc = self.GetDescriptor();
 
         // 1b. Derived properties
-        if (skey == "Position") {
-            auto* desc = ClassDescriptor::Get(self.GetClassName());
-            while (desc) {
-                if (auto it = desc->properties.find("CFrame"); it != desc->properties.end()) {
-                    PropertyValue val = it->second->get(&self);
-                    if (val.isCFrame()) {
-                        return luabridge::LuaRef(L, val.toCFrame().position);
-                    }
-                    break;
+        if (skey == "Position" && desc) {
+            if (auto* cframe = desc->FindProperty("CFrame")) {
+                PropertyValue val = cframe->get(&self);
+                if (val.isCFrame()) {
+                    return luabridge::LuaRef(L, val.toCFrame().position);
                 }
-                desc = desc->baseClass;
             }
         }
 
-        // 2. Walk the ClassDescriptor chain
-        auto* desc = ClassDescriptor::Get(self.GetClassName());
-        while (desc) {
-            // Check properties
-            if (auto it = desc->properties.find(skey); it != desc->properties.end()) {
-                PropertyValue val = it->second->get(&self);
-                return propertyValueToLua(L, val);
-            }
-
-            // Check methods
-            if (auto it = desc->methods.find(skey); it != desc->methods.end()) {
-                // Create a callable function that captures the instance and method
-                auto methodCall = it->second.call;
-                return luabridge::LuaRef(L, [inst = &self, methodCall](lua_State* L) -> int {
-                    return methodCall(L, inst);
-                });
-            }
-
-            // Check signals
-            if (auto it = desc->signals.find(skey); it != desc->signals.end()) {
-                Signal* sig = it->second.getter(&self);
-                return luabridge::LuaRef(L, sig);
+        // 2. One lookup in the flattened member table
+        if (const MemberRef* member = desc ? desc->FindMember(skey) : nullptr) {
+            switch (member->kind) {
+                case MemberRef::Kind::Property:
+                    desc->flatProperties[member->index].accessor->push(L, &self);
+                    return luabridge::LuaRef::fromStack(L);
+                case MemberRef::Kind::Method: {
+                    // Descriptors live for the whole run, so the closure can hold a raw pointer
+                    const MethodDescriptor* method = desc->flatMethods[member->index];
+                    lua_pushlightuserdata(L, &self);
+                    lua_pushlightuserdata(L, const_cast<MethodDescriptor*>(method));
+                    lua_pushcclosure(L, LuaCallMethod, method->name.c_str(), 2);
+                    return luabridge::LuaRef::fromStack(L);
+                }
+                case MemberRef::Kind::Signal:
+                    return luabridge::LuaRef(L, desc->flatSignals[member->index]->getter(&self));
             }
-
-            // Walk up inheritance
-            desc = desc->baseClass;
         }
 
         // 3. Check children by name
-        for (auto& child : self.children) {
-            if (child->GetName() == skey) {
-                return luabridge::LuaRef(L, child);
-            }
+        if (auto child = self.FindChildByName(skey)) {
+            return luabridge::LuaRef(L, child);
         }
 
         return luabridge::LuaRef(L);
     }
 
+    // Shared tail of every reflected write from Lua
+    static void AfterLuaPropertySet(Instance& self, const ClassDescriptor* desc, PropertyID id, bool replicate) {
+        const std::string& name = desc->GetPropertyName(id);
+        self.OnPropertyChanged(name);
+        self.NotifyPropertyChanged(id);
+
+        // Notify NetworkService
+        if (self.networkID != 0 && replicate) {
+            if (auto dm = self.GetDataModel()) {
+                if (auto network = dm->GetService<NetworkService>()) {
+                    network->MarkDirty(&self, id);
+                }
+            }
+        }
+    }
+
     luabridge::LuaRef Instance::LuaNewIndex(Instance& self, const luabridge::LuaRef& key, const luabridge::LuaRef& value, lua_State* L) {
         if (!key.isString()) return luabridge::LuaRef(L);
-        std::string skey = key.unsafe_cast<std::string>();
+        std::string_view skey = LuaKeyView(key, L);
 
         // 1. Special case: Name
         if (skey == "Name") {
             if (value.isString()) {
-                self.m_debugName = value.unsafe_cast<std::string>();
+                self.SetName(value.unsafe_cast<std::string>());
             }
             return luabridge::LuaRef(L);
         }
@@ -167,6 +308,9 @@ namespace Nova {
             return luabridge::LuaRef(L);
         }
 
+        auto* desc = self.GetDescriptor();
+        if (!desc) return luabridge::LuaRef(L);
+
         // 3. Special case: Position
         if (skey == "Position") {
             luabridge::push(L, value);
@@ -174,46 +318,21 @@ namespace Nova {
                 auto result = luabridge::Stack<Vector3>::get(L, -1);
                 if (result) {
                     Vector3 pos = result.value();
-                    auto* desc = ClassDescriptor::Get(self.GetClassName());
-                    while (desc) {
-                        // First try: find CFrame and update its position (for BasePart, etc.)
-                        if (auto it = desc->properties.find("CFrame"); it != desc->properties.end()) {
-                            PropertyValue cfVal = it->second->get(&self);
-                            if (cfVal.isCFrame()) {
-                                CFrame cf = cfVal.toCFrame();
-                                cf.position = pos;
-                                it->second->set(&self, PropertyValue(cf));
-                                self.OnPropertyChanged("CFrame");
-
-                                // Notify NetworkService
-                                if (self.networkID != 0) {
-                                    if (auto dm = self.GetDataModel()) {
-                                        if (auto network = dm->GetService<NetworkService>()) {
-                                            network->MarkDirty(&self, "CFrame");
-                                        }
-                                    }
-                                }
-                            }
-                            lua_pop(L, 1);
-                            return luabridge::LuaRef(L);
+                    // First try: update the CFrame's position (BasePart, etc.)
+                    if (PropertyID id = desc->FindPropertyID("CFrame"); id != InvalidPropertyID) {
+                        auto* accessor = desc->GetProperty(id);
+                        PropertyValue cfVal = accessor->get(&self);
+                        if (cfVal.isCFrame()) {
+                            CFrame cf = cfVal.toCFrame();
+                            cf.position = pos;
+                            accessor->set(&self, PropertyValue(cf));
+                            AfterLuaPropertySet(self, desc, id, true);
                         }
-                        // Second try: find Position directly (for Explosion, etc.)
-                        if (auto it = desc->properties.find("Position"); it != desc->properties.end()) {
-                            it->second->set(&self, PropertyValue(pos));
-                            self.OnPropertyChanged("Position");
-
-                            // Notify NetworkService
-                            if (self.networkID != 0) {
-                                if (auto dm = self.GetDataModel()) {
-                                    if (auto network = dm->GetService<NetworkService>()) {
-                                        network->MarkDirty(&self, "Position");
-                                    }
-                                }
-                            }
-                            lua_pop(L, 1);
-                            return luabridge::LuaRef(L);
-                        }
-                        desc = desc->baseClass;
+                    }
+                    // Second try: a Position property of its own (Explosion, etc.)
+                    else if (PropertyID id = desc->FindPropertyID("Position"); id != InvalidPropertyID) {
+                        desc->GetProperty(id)->set(&self, PropertyValue(pos));
+                        AfterLuaPropertySet(self, desc, id, true);
                     }
                 }
             }
@@ -221,40 +340,26 @@ namespace Nova {
             return luabridge::LuaRef(L);
         }
 
-        // 4. Convert value to PropertyValue
-        PropertyValue propVal = luaToPropertyValue(value);
-
-        // 5. Walk the ClassDescriptor chain to find and set the property
-        auto* desc = ClassDescriptor::Get(self.GetClassName());
-        while (desc) {
-            if (auto it = desc->properties.find(skey); it != desc->properties.end()) {
-                if (it->second->set(&self, propVal)) {
-                    self.OnPropertyChanged(skey);
-
-                    // Notify NetworkService if this is a replicated property
-                    if (self.networkID != 0 && desc->replicatedProperties.contains(skey)) {
-                        if (auto dm = self.GetDataModel()) {
-                            if (auto network = dm->GetService<NetworkService>()) {
-                                network->MarkDirty(&self, skey);
-                            }
-                        }
-                    }
-                } else {
-                    LOG_WRN("Instance", "Failed to set property '%s' on %s", skey.c_str(), self.GetClassName().c_str());
-                }
-                return luabridge::LuaRef(L);
-            }
-            desc = desc->baseClass;
+        // 4. Find the property, then let its typed thunk read the value off the stack
+        PropertyID id = desc->FindPropertyID(skey);
+        if (id == InvalidPropertyID) {
+            // Silently ignore unknown properties — Lua scripts may set arbitrary keys
+            return luabridge::LuaRef(L);
         }
 
-        // Silently ignore unknown properties — Lua scripts may set arbitrary keys
+        luabridge::push(L, value);
+        bool ok = desc->GetProperty(id)->check(L, -1, &self);
+        lua_pop(L, 1);
+        if (ok) {
+            AfterLuaPropertySet(self, desc, id, desc->IsReplicated(id));
+        } else {
+            LOG_WRN("Instance", "Failed to set property '%s' on %s", desc->GetPropertyName(id).c_str(), self.GetClassName().c_str());
+        }
         return luabridge::LuaRef(L);
     }
 
     std::shared_ptr<Instance> Instance::FindFirstChild(const std::string& name, bool recursive) {
-        for (auto& child : children) {
-            if (child->GetName() == name) return child;
-        }
+        if (auto child = FindChildByName(name)) return child;
         if (recursive) {
             for (auto& child : children) {
                 if (auto found = child->FindFirstChild(name, true)) return found;
@@ -264,6 +369,12 @@ namespace Nova {
     }
 
     std::shared_ptr<Instance> Instance::FindFirstChildOfClass(const std::string& className) {
+        if (auto* target = ClassDescriptor::Get(className)) {
+            for (auto& child : children) {
+                if (child->GetDescriptor() == target) return child;
+            }
+            return nullptr;
+        }
         for (auto& child : children) {
             if (child->GetClassName() == className) return child;
         }
@@ -271,8 +382,9 @@ namespace Nova {
     }
 
     std::shared_ptr<Instance> Instance::FindFirstChildWhichIsA(const std::string& className, bool recursive) {
+        auto* target = ClassDescriptor::Get(className);
         for (auto& child : children) {
-            if (child->IsA(className)) return child;
+            if (target ? child->IsA(target) : child->IsA(className)) return child;
         }
         if (recursive) {
             for (auto& child : children) {
@@ -292,18 +404,20 @@ namespace Nova {
     }
 
     std::shared_ptr<Instance> Instance::FindFirstAncestorOfClass(const std::string& className) {
+        auto* target = ClassDescriptor::Get(className);
         auto p = parent.lock();
         while (p) {
-            if (p->GetClassName() == className) return p;
+            if (target ? p->GetDescriptor() == target : p->GetClassName() == className) return p;
             p = p->parent.lock();
         }
         return nullptr;
     }
 
     std::shared_ptr<Instance> Instance::FindFirstAncestorWhichIsA(const std::string& className) {
+        auto* target = ClassDescriptor::Get(className);
         auto p = parent.lock();
         while (p) {
-            if (p->IsA(className)) return p;
+            if (target ? p->IsA(target) : p->IsA(className)) return p;
             p = p->parent.lock();
         }
         return nullptr;
@@ -311,18 +425,70 @@ namespace Nova {
 
     std::vector<std::shared_ptr<Instance>> Instance::GetDescendants() {
         std::vector<std::shared_ptr<Instance>> result;
-        for (auto& child : children) {
-            result.push_back(child);
-            auto childDescendants = child->GetDescendants();
-            result.insert(result.end(), childDescendants.begin(), childDescendants.end());
-        }
+        CollectDescendants(result);
         return result;
     }
 
+    void Instance::CollectDescendants(std::vector<std::shared_ptr<Instance>>& out) {
+        out.reserve(out.size() + CountDescendants());
+        ForEachDescendant([&out](const std::shared_ptr<Instance>& d) { out.push_back(d); });
+    }
+
+    size_t Instance::CountDescendants() const {
+        size_t count = 0;
+        std::vector<const Instance*> stack = { this };
+        while (!stack.empty()) {
+            const Instance* node = stack.back();
+            stack.pop_back();
+            count += node->children.size();
+            for (auto& child : node->children) {
+                if (!child->children.empty()) stack.push_back(child.get());
+            }
+        }
+        return count;
+    }
+
+    namespace {
+        // Walk state owned by the Lua closure; holds strong refs so the subtree
+        // survives yields. Reparenting mid-walk may skip or repeat nodes.
+        struct DescendantIterator {
+            std::vector<std::pair<std::shared_ptr<Instance>, size_t>> stack;
+            int index = 0;
+        };
+
+        int IterDescendantsNext(lua_State* L) {
+            auto* it = static_cast<DescendantIterator*>(lua_touserdata(L, lua_upvalueindex(1)));
+            while (!it->stack.empty()) {
+                auto& [node, next] = it->stack.back();
+                if (next >= node->children.size()) {
+                    it->stack.pop_back();
+                    continue;
+                }
+                std::shared_ptr<Instance> child = node->children[next++];
+                if (!child->children.empty()) it->stack.emplace_back(child, 0);
+
+                lua_pushinteger(L, ++it->index);
+                luabridge::push(L, child);
+                return 2;
+            }
+            return 0;
+        }
+    }
+
+    int Instance::LuaIterDescendants(lua_State* L) {
+        void* mem = lua_newuserdatadtor(L, sizeof(DescendantIterator), [](void* p) {
+            static_cast<DescendantIterator*>(p)->~DescendantIterator();
+        });
+        auto* it = new (mem) DescendantIterator();
+        it->stack.emplace_back(shared_from_this(), 0);
+        lua_pushcclosure(L, IterDescendantsNext, "IterDescendants", 1);
+        return 1;
+    }
+
     std::string Instance::GetFullName() {
         std::string result = GetName();
         auto p = parent.lock();
-        while (p && !std::dynamic_pointer_cast<DataModel>(p)) {
+        while (p && p.get() != m_dataModel) {
             result = p->GetName() + "." + result;
             p = p->parent.lock();
         }
@@ -330,53 +496,124 @@ namespace Nova {
     }
 
     bool Instance::IsA(const std::string& className) {
-        auto* desc = ClassDescriptor::Get(GetClassName());
+        auto* desc = GetDescriptor();
         if (desc) return desc->IsA(className);
         return GetClassName() == className;
     }
 
-    std::shared_ptr<Instance> Instance::Clone() {
-        auto inst = InstanceFactory::Get().Create(GetClassName());
-        if (!inst) return nullptr;
-
-        // Copy properties via ClassDescriptor
-        auto* desc = ClassDescriptor::Get(GetClassName());
-        if (desc) {
-            for (auto& [name, accessor] : desc->properties) {
-                PropertyValue val = accessor->get(this);
-                accessor->set(inst.get(), val);
+    bool Instance::IsA(const ClassDescriptor* target) const {
+        auto* desc = GetDescriptor();
+        return desc && desc->IsA(target);
+    }
+
+    const ClassDescriptor* Instance::GetDescriptor() const {
+        auto* desc = m_descriptor.load(std::memory_order_relaxed);
+        if (!desc) {
+            desc = ClassDescriptor::Get(GetClassName());
+            m_descriptor.store(desc, std::memory_order_relaxed);
+        }
+        return desc;
+    }
+
+    std::shared_ptr<Instance> Instance::CloneSelf() const {
+        auto copy = InstanceFactory::Get().Create(GetClassName());
+        if (!copy) return nullptr;
+
+        copy->m_debugName = m_debugName;
+        if (auto* desc = GetDescriptor()) {
+            for (auto& property : desc->flatProperties) {
+                property.accessor->copy(this, copy.get());
             }
         }
+        return copy;
+    }
 
-        for (auto& child : children) {
-            auto childClone = child->Clone();
-            if (childClone) {
-                childClone->SetParent(inst);
+    std::shared_ptr<Instance> Instance::Clone() {
+        CloneMap copies;
+        return Clone(copies);
+    }
+
+    std::shared_ptr<Instance> Instance::Clone(CloneMap& copies) {
+        auto root = CloneSelf();
+        if (!root) return nullptr;
+
+        copies.emplace(this, root.get());
+
+        // The copy is detached, so children are linked directly rather than through SetParent
+        std::vector<std::pair<const Instance*, Instance*>> stack;
+        stack.emplace_back(this, root.get());
+        while (!stack.empty()) {
+            auto [source, copy] = stack.back();
+            stack.pop_back();
+
+            copy->children.reserve(source->children.size());
+            for (auto& child : source->children) {
+                auto childCopy = child->CloneSelf();
+                if (!childCopy) continue;
+                childCopy->parent = copy->weak_from_this();
+                copies.emplace(child.get(), childCopy.get());
+                stack.emplace_back(child.get(), childCopy.get());
+                copy->children.push_back(std::move(childCopy));
             }
         }
 
-        return inst;
+        // References into the cloned subtree are retargeted to the copies,
+        // references outside it keep their original target
+        for (auto& [source, copy] : copies) {
+            auto* desc = copy->GetDescriptor();
+            if (!desc) continue;
+            for (auto& reference : desc->flatReferences) {
+                auto target = reference.accessor->get(source);
+                if (!target) continue;
+                if (auto it = copies.find(target.get()); it != copies.end()) {
+                    reference.accessor->set(copy, it->second->shared_from_this());
+                } else {
+                    reference.accessor->set(copy, target);
+                }
+            }
+        }
+        return root;
     }
 
     void Instance::Destroy() {
         if (m_destroyed) return;
-        m_destroyed = true;
 
-        // Notify NetworkService to broadcast destroy to clients
-        if (networkID != 0) {
-            if (auto dm = GetDataModel()) {
-                if (auto network = dm->GetService<NetworkService>()) {
-                    network->BroadcastDestroyObject(networkID);
-                }
+        // Pooled blocks of the torn-down subtree are returned in one pass
+        BulkReleaseScope release;
+
+        std::vector<std::shared_ptr<Instance>> subtree = { shared_from_this() };
+        CollectDescendants(subtree);
+        BulkReleaseScope::Reserve(subtree.size());
+
+        DataModel* dm = m_dataModel;
+        if (dm) {
+            if (auto* network = dm->FindService<NetworkService>()) {
+                network->OnSubtreeDestroyed(subtree);
             }
         }
 
-        auto childrenCopy = children;
-        for (auto& child : childrenCopy) {
-            child->Destroy();
+        // One teardown pass and one bulk physics call instead of a SetParent per node
+        DestroyBatch batch;
+        batch.workspace = m_inWorkspace ? dm->FindService<Workspace>() : nullptr;
+        if (auto* physics = dm ? dm->FindService<PhysicsService>() : nullptr) {
+            batch.physics = std::static_pointer_cast<PhysicsService>(physics->shared_from_this());
+        }
+        for (auto& inst : subtree) inst->OnDestroying(batch);
+        if (batch.physics) {
+            batch.physics->BulkUnregisterConstraints(batch.joints);
+            batch.physics->BulkUnregisterParts(batch.parts);
         }
-        children.clear();
 
-        SetParent(nullptr);
+        DetachFromParent();
+
+        for (auto& inst : subtree) {
+            inst->m_destroyed = true;
+            inst->m_changedMask = 0;
+            inst->m_dataModel = nullptr;
+            inst->m_inWorkspace = false;
+            inst->parent.reset();
+            inst->children.clear();
+            inst->m_childIndex.reset();
+        }
     }
 }
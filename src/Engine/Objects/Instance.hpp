@@ -13,6 +13,9 @@
 #include <memory>
 #include <algorithm>
 #include <iostream>
+#include <atomic>
+#include <string_view>
+#include <unordered_map>
 
 #include <lua.h>
 #include <lualib.h>
@@ -24,25 +27,58 @@
 #undef lua_rawsetp
 #include <LuaBridge/LuaBridge.h>
 
+#include "Engine/Reflection/ClassDescriptor.hpp"
+
 namespace Nova {
     class DataModel;
+    class Workspace;
+    class PhysicsService;
+    class BasePart;
+    class JointInstance;
 
     using NetworkID = uint32_t;
 
+    // Teardown gathered over a subtree by OnDestroying and flushed once by Destroy
+    struct DestroyBatch {
+        Workspace* workspace = nullptr;     // Set when the subtree is in the Workspace
+        std::shared_ptr<PhysicsService> physics;  // The DataModel's, else the first registered part's
+        std::vector<BasePart*> parts;
+        std::vector<JointInstance*> joints;
+    };
+
     class Instance : public std::enable_shared_from_this<Instance> {
     public:
+        using CloneMap = std::unordered_map<const Instance*, Instance*>;
+
         virtual ~Instance() = default;
 
         virtual std::string GetClassName() const = 0;
-        virtual std::string GetName() const = 0;
+        virtual const std::string& GetName() const = 0;
+        void SetName(const std::string& name);
 
         virtual void OnPropertyChanged(const std::string& name) {}
 
+        // Changed / GetPropertyChangedSignal. A property's bit in the subscriber mask
+        // is set while its signal has live connections, so notifying an unwatched
+        // property is one mask test however often scripts read the signal.
+        Signal* GetChangedSignal();
+        Signal* GetPropertyChangedSignal(const std::string& name);
+        // Bit for a property in the per-instance masks; IDs past 63 share the last bit
+        static uint64_t PropertyBit(PropertyID id) { return uint64_t(1) << std::min<PropertyID>(id, 63); }
+        bool HasPropertyListener(PropertyID id) const { return (m_changedMask & PropertyBit(id)) != 0; }
+        void NotifyPropertyChanged(PropertyID id) {
+            if (HasPropertyListener(id)) FirePropertyChanged(id);
+        }
+        void NotifyPropertyChanged(const std::string& name) {
+            if (m_changedMask) NotifyPropertyChangedByName(name);
+        }
+
         std::weak_ptr<Instance> parent;
         std::vector<std::shared_ptr<Instance>> children;
 
         std::string m_debugName;
         NetworkID networkID = 0;  // 0 = not replicated
+        uint64_t dirtyMask = 0;   // Properties awaiting replication, owned by NetworkService
         Instance(std::string name) : m_debugName(name) {}
 
         std::shared_ptr<Instance> GetParent() const { return parent.lock(); }
@@ -56,18 +92,63 @@ namespace Nova {
         std::shared_ptr<Instance> FindFirstAncestorWhichIsA(const std::string& className);
 
         std::vector<std::shared_ptr<Instance>> GetDescendants();
+        void CollectDescendants(std::vector<std::shared_ptr<Instance>>& out);
+        size_t CountDescendants() const;
+
+        // Iterative pre-order walk; fn must not reparent anything in the subtree
+        template<typename Fn>
+        void ForEachDescendant(Fn&& fn) {
+            std::vector<std::pair<Instance*, size_t>> stack;
+            stack.emplace_back(this, 0);
+            while (!stack.empty()) {
+                auto& [node, next] = stack.back();
+                if (next >= node->children.size()) {
+                    stack.pop_back();
+                    continue;
+                }
+                const std::shared_ptr<Instance>& child = node->children[next++];
+                fn(child);
+                if (!child->children.empty()) stack.emplace_back(child.get(), 0);
+            }
+        }
+
+        // Lua: for i, d in inst:IterDescendants() do ... end
+        int LuaIterDescendants(lua_State* L);
         std::string GetFullName();
 
         bool IsA(const std::string& className);
+        bool IsA(const ClassDescriptor* desc) const;
+
+        template<typename T>
+        bool IsA() const { return IsA(ClassDescriptor::Of<T>()); }
+
+        // Cached on first use; nullptr for classes without a descriptor
+        const ClassDescriptor* GetDescriptor() const;
+
+        // Copies the subtree detached; parenting the result attaches it in one batch.
+        // Values go member to member through the same accessors the serializer
+        // uses, but not through a stream: references to instances outside the
+        // subtree are kept, where a stream can only write them as none.
         std::shared_ptr<Instance> Clone();
+        // As above, and fills copies with every source -> copy pair
+        std::shared_ptr<Instance> Clone(CloneMap& copies);
         void Destroy();
 
         void SetParent(std::shared_ptr<Instance> newParent);
+        // Unlinks from the parent without running OnAncestorChanged, for engine
+        // code that has already torn the subtree down itself
+        void DetachSilently();
 
-        std::shared_ptr<DataModel> GetDataModel();
+        // Cached ancestry, refreshed by SetParent whenever the subtree moves
+        DataModel* GetDataModel() const { return m_dataModel; }
+        bool IsInWorkspace() const { return m_inWorkspace; }
         bool IsDescendantOf(std::shared_ptr<Instance> other);
 
         virtual void OnAncestorChanged(std::shared_ptr<Instance> instance, std::shared_ptr<Instance> newParent);
+        // Runs on every node of a subtree being destroyed, while it is still
+        // attached. Destroy unlinks without OnAncestorChanged, so class teardown
+        // that must happen on destruction belongs here.
+        virtual void OnDestroying(DestroyBatch& batch) {}
 
         static luabridge::LuaRef LuaIndex(Instance& self, const luabridge::LuaRef& key, lua_State* L);
         static luabridge::LuaRef LuaNewIndex(Instance& self, const luabridge::LuaRef& key, const luabridge::LuaRef& value, lua_State* L);
@@ -77,5 +158,40 @@ namespace Nova {
 
     protected:
         bool m_destroyed = false;
+        DataModel* m_dataModel = nullptr;
+        bool m_inWorkspace = false;
+
+        // Clears the cached DataModel of every descendant; used when the DataModel dies
+        void DetachDescendantsFromDataModel();
+
+        // Direct child list changes, called by SetParent on the affected parent
+        virtual void OnChildAdded(const std::shared_ptr<Instance>& child) {}
+        virtual void OnChildRemoved(Instance* child) {}
+
+    private:
+        static constexpr size_t ChildIndexThreshold = 16;
+
+        mutable std::atomic<const ClassDescriptor*> m_descriptor{nullptr};
+
+        struct PropertySignals {
+            Signal changed;
+            std::unordered_map<PropertyID, std::unique_ptr<Signal>> byProperty;
+        };
+        std::unique_ptr<PropertySignals> m_propertySignals;
+        uint64_t m_changedMask = 0;
+
+        PropertySignals& GetPropertySignals();
+        void RecomputeChangedMask();
+        void FirePropertyChanged(PropertyID id);
+        void NotifyPropertyChangedByName(const std::string& name);
+
+        // Name -> index into children, built lazily for large child lists.
+        // Keys view the children's names, so renames and removals drop it.
+        std::unique_ptr<std::unordered_map<std::string_view, size_t>> m_childIndex;
+
+        std::shared_ptr<Instance> FindChildByName(std::string_view name);
+        std::shared_ptr<Instance> CloneSelf() const;
+        void UpdateAncestry(DataModel* dataModel, bool inWorkspace);
+        void DetachFromParent();
     };
 }
@@ -12,6 +12,7 @@
 #include <functional>
 #include <map>
 #include "Engine/Nova.hpp"
+#include "Engine/Objects/InstancePool.hpp"
 
 #include "Engine/Objects/Explosion.hpp"
 #include "Engine/Objects/Script.hpp"
@@ -33,14 +34,17 @@ namespace Nova {
             return factory;
         }
 
+        // Instances come from per-size slab pools; object and control block share one block
         template<typename T>
         void Register(const std::string& className) {
-            creators[className] = []() { return std::make_shared<T>(); };
+            creators[className] = []() -> std::shared_ptr<Nova::Instance> {
+                return MakePooled<T>();
+            };
         }
 
-        std::shared_ptr<Nova::Instance> Create(const std::string& className) {
-            if (creators.contains(className)) {
-                return creators[className]();
+        std::shared_ptr<Nova::Instance> Create(const std::string& className) const {
+            if (auto it = creators.find(className); it != creators.end()) {
+                return it->second();
             }
             return nullptr;
         }
@@ -0,0 +1,250 @@
+// Nova Game Engine
+// Copyright (C) 2026  brambora69123
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace Nova {
+    class SlabPoolBase {
+    public:
+        virtual ~SlabPoolBase() = default;
+        virtual void Release(void* block) = 0;
+        virtual void ReleaseBatch(void* const* blocks, size_t count) = 0;
+    };
+
+    // Defers pooled frees on the current thread until the outermost scope ends,
+    // then hands them back with one lock per pool. Used around subtree teardown.
+    class BulkReleaseScope {
+    public:
+        BulkReleaseScope() { State().depth++; }
+        ~BulkReleaseScope() {
+            auto& state = State();
+            if (--state.depth == 0) Flush(state);
+        }
+
+        BulkReleaseScope(const BulkReleaseScope&) = delete;
+        BulkReleaseScope& operator=(const BulkReleaseScope&) = delete;
+
+        // Returns false when no scope is active, or the block could not be queued,
+        // and the caller should free directly. Runs inside noexcept deallocation.
+        static bool Defer(SlabPoolBase* pool, void* block) noexcept {
+            auto& state = State();
+            if (state.depth == 0) return false;
+            try {
+                state.deferred.emplace_back(pool, block);
+            } catch (const std::bad_alloc&) {
+                return false;
+            }
+            return true;
+        }
+
+        // Sizes the queue up front for a teardown of known size
+        static void Reserve(size_t blocks) {
+            auto& state = State();
+            state.deferred.reserve(state.deferred.size() + blocks);
+        }
+
+    private:
+        struct ThreadState {
+            int depth = 0;
+            std::vector<std::pair<SlabPoolBase*, void*>> deferred;
+        };
+
+        static ThreadState& State() {
+            static thread_local ThreadState state;
+            return state;
+        }
+
+        static void Flush(ThreadState& state) {
+            if (state.deferred.empty()) return;
+
+            std::sort(state.deferred.begin(), state.deferred.end());
+            std::vector<void*> run;
+            size_t i = 0;
+            while (i < state.deferred.size()) {
+                SlabPoolBase* pool = state.deferred[i].first;
+                run.clear();
+                for (; i < state.deferred.size() && state.deferred[i].first == pool; i++) {
+                    run.push_back(state.deferred[i].second);
+                }
+                pool->ReleaseBatch(run.data(), run.size());
+            }
+            state.deferred.clear();
+        }
+    };
+
+    // Fixed-size block pool carved from 64 KiB slabs. One pool exists per
+    // (size, alignment) pair, so classes of equal footprint share blocks.
+    // Each thread keeps up to CacheLimit free blocks of its own and trades with
+    // the shared free list CacheBatch blocks at a time, so loader workers only
+    // take the pool lock once per batch. Slabs are never returned to the OS:
+    // the pool's footprint is its high-water mark, and freed blocks are reused
+    // by later instances of any class of the same size.
+    template<size_t Size, size_t Align>
+    class SlabPool final : public SlabPoolBase {
+    public:
+        static constexpr size_t BlockAlign = std::max(Align, alignof(void*));
+        static constexpr size_t BlockSize = (std::max(Size, sizeof(void*)) + BlockAlign - 1) / BlockAlign * BlockAlign;
+        static constexpr size_t SlabBytes = 64 * 1024;
+        static constexpr size_t BlocksPerSlab = std::max<size_t>(1, SlabBytes / BlockSize);
+        static constexpr size_t CacheBatch = 32;
+        static constexpr size_t CacheLimit = 2 * CacheBatch;
+
+        // Intentionally leaked: instances may still be released during static destruction
+        static SlabPool& Get() {
+            static SlabPool* pool = new SlabPool();
+            return *pool;
+        }
+
+        void* Allocate() {
+            ThreadCache& cache = tCache;
+            if (cache.closed) {
+                std::lock_guard<std::mutex> lock(mMutex);
+                return Pop();
+            }
+            if (!cache.head) Refill(cache);
+            FreeBlock* block = cache.head;
+            cache.head = block->next;
+            cache.count--;
+            return block;
+        }
+
+        void Deallocate(void* block) {
+            if (BulkReleaseScope::Defer(this, block)) return;
+            ThreadCache& cache = tCache;
+            if (cache.closed) {
+                Release(block);
+                return;
+            }
+            auto* node = static_cast<FreeBlock*>(block);
+            node->next = cache.head;
+            cache.head = node;
+            if (++cache.count > CacheLimit) Spill(cache, CacheBatch);
+        }
+
+        void Release(void* block) override {
+            std::lock_guard<std::mutex> lock(mMutex);
+            Push(block);
+        }
+
+        void ReleaseBatch(void* const* blocks, size_t count) override {
+            std::lock_guard<std::mutex> lock(mMutex);
+            for (size_t i = 0; i < count; i++) Push(blocks[i]);
+        }
+
+    private:
+        struct FreeBlock { FreeBlock* next; };
+
+        // Trivially destructible, so it stays usable after the thread's flusher
+        // has run; closed then routes the thread straight to the shared list
+        struct ThreadCache {
+            FreeBlock* head = nullptr;
+            size_t count = 0;
+            bool closed = false;
+        };
+
+        // Hands a thread's cached blocks back when the thread exits
+        struct CacheFlusher {
+            ~CacheFlusher() {
+                ThreadCache& cache = tCache;
+                Get().Spill(cache, cache.count);
+                cache.closed = true;
+            }
+        };
+
+        static inline thread_local ThreadCache tCache;
+        static inline thread_local CacheFlusher tFlusher;
+
+        std::mutex mMutex;
+        FreeBlock* mFreeList = nullptr;
+
+        SlabPool() = default;
+
+        FreeBlock* Pop() {
+            if (!mFreeList) Grow();
+            FreeBlock* block = mFreeList;
+            mFreeList = block->next;
+            return block;
+        }
+
+        void Refill(ThreadCache& cache) {
+            (void)&tFlusher;  // Registers the exit flush on this thread's first refill
+            std::lock_guard<std::mutex> lock(mMutex);
+            for (size_t i = 0; i < CacheBatch; i++) {
+                FreeBlock* block = Pop();
+                block->next = cache.head;
+                cache.head = block;
+            }
+            cache.count += CacheBatch;
+        }
+
+        void Spill(ThreadCache& cache, size_t count) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            for (size_t i = 0; i < count && cache.head; i++) {
+                FreeBlock* block = cache.head;
+                cache.head = block->next;
+                cache.count--;
+                Push(block);
+            }
+        }
+
+        void Push(void* block) {
+            auto* node = static_cast<FreeBlock*>(block);
+            node->next = mFreeList;
+            mFreeList = node;
+        }
+
+        void Grow() {
+            auto* slab = static_cast<std::byte*>(::operator new(BlocksPerSlab * BlockSize, std::align_val_t(BlockAlign)));
+            for (size_t i = BlocksPerSlab; i-- > 0;) {
+                Push(slab + i * BlockSize);
+            }
+        }
+    };
+
+    // Allocator for std::allocate_shared. The object and its control block land
+    // in a single pooled block sized for the rebound type.
+    template<typename T>
+    struct PoolAllocator {
+        using value_type = T;
+
+        PoolAllocator() = default;
+        template<typename U>
+        PoolAllocator(const PoolAllocator<U>&) noexcept {}
+
+        T* allocate(size_t n) {
+            if (n != 1) return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+            return static_cast<T*>(SlabPool<sizeof(T), alignof(T)>::Get().Allocate());
+        }
+
+        void deallocate(T* p, size_t n) noexcept {
+            if (n != 1) {
+                ::operator delete(p, std::align_val_t(alignof(T)));
+                return;
+            }
+            SlabPool<sizeof(T), alignof(T)>::Get().Deallocate(p);
+        }
+
+        template<typename U>
+        bool operator==(const PoolAllocator<U>&) const noexcept { return true; }
+        template<typename U>
+        bool operator!=(const PoolAllocator<U>&) const noexcept { return false; }
+    };
+
+    // Pooled replacement for std::make_shared, for every Instance the engine creates
+    template<typename T, typename... Args>
+    std::shared_ptr<T> MakePooled(Args&&... args) {
+        return std::allocate_shared<T>(PoolAllocator<T>{}, std::forward<Args>(args)...);
+    }
+}
@@ -25,21 +25,31 @@ namespace Nova {
     void JointInstance::OnAncestorChanged(std::shared_ptr<Instance> instance, std::shared_ptr<Instance> newParent) {
         Instance::OnAncestorChanged(instance, newParent);
 
-        auto dm = GetDataModel();
-        if (dm) {
-            auto workspace = dm->GetService<Workspace>();
-            if (IsDescendantOf(workspace)) {
-                RebuildConstraint();
+        if (IsInWorkspace()) {
+            auto dm = GetDataModel();
+            if (dm->IsBatching()) {
+                dm->QueueConstraint(std::static_pointer_cast<JointInstance>(shared_from_this()));
             } else {
-                if (physicsConstraint) {
-                    if (auto physics = registeredService.lock()) {
-                        physics->UnregisterConstraint(this);
-                    }
-                }
+                RebuildConstraint();
+            }
+        } else if (physicsConstraint) {
+            if (auto physics = registeredService.lock()) {
+                physics->UnregisterConstraint(this);
             }
         }
     }
 
+    void JointInstance::OnDestroying(DestroyBatch& batch) {
+        if (!physicsConstraint) return;
+        auto physics = registeredService.lock();
+        if (!batch.physics) batch.physics = physics;
+        if (physics == batch.physics) {
+            batch.joints.push_back(this);
+        } else if (physics) {
+            physics->UnregisterConstraint(this);
+        }
+    }
+
     void JointInstance::RebuildConstraint() {}
 
     void AutoJoint::RebuildConstraint() {
@@ -27,10 +27,11 @@ namespace Nova {
         virtual ~JointInstance();
 
         void OnAncestorChanged(std::shared_ptr<Instance> instance, std::shared_ptr<Instance> newParent) override;
+        void OnDestroying(DestroyBatch& batch) override;
         virtual void RebuildConstraint();
 
         std::string GetClassName() const override { return "JointInstance"; }
-        std::string GetName() const override { return m_debugName; }
+        const std::string& GetName() const override { return m_debugName; }
     };
 
     class AutoJoint : public JointInstance {
@@ -94,4 +95,13 @@ namespace Nova {
         void SetTargetVelocity(float velocity);
         std::string GetClassName() const override { return "VelocityMotor"; }
     };
+
+    // Rigid joints fuse their parts into one assembly; the rest become Jolt constraints
+    inline bool IsRigidJoint(const JointInstance& joint) {
+        return joint.IsA<Weld>() || joint.IsA<Snap>() || joint.IsA<Glue>() || joint.IsA<AutoJoint>();
+    }
+
+    inline bool IsHingeJoint(const JointInstance& joint) {
+        return joint.IsA<Motor>() || joint.IsA<Hinge>() || joint.IsA<VelocityMotor>();
+    }
 }
@@ -16,6 +16,6 @@ namespace Nova {
 
         Model() : Instance("Model") {}
         std::string GetClassName() const override { return "Model"; }
-        std::string GetName() const override { return m_debugName; }
+        const std::string& GetName() const override { return m_debugName; }
     };
 }
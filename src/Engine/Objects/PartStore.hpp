@@ -0,0 +1,85 @@
+// Nova Game Engine
+// Copyright (C) 2026  brambora69123
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+#pragma once
+#include "Common/MathTypes.hpp"
+#include "Engine/Objects/BasePart.hpp"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Nova {
+    // Front, back, left, right, top, bottom — the order the renderer packs them
+    using PartSurfaces = std::array<uint8_t, 6>;
+
+    // Hot per-part state in parallel arrays, indexed by BasePart::workspaceIndex.
+    // The BasePart members stay authoritative; writers mirror them here through
+    // BasePart::SyncHotState or SetCFrame, which reach the owning Workspace
+    // through the part's cached registeredWorkspace, so per-frame loops can
+    // stream contiguous memory.
+    class PartStore {
+    public:
+        std::vector<CFrame> cframes;
+        std::vector<Vector3> sizes;
+        std::vector<glm::vec4> colors;   // Resolved RGB, alpha = 1 - transparency
+        std::vector<PartSurfaces> surfaces;
+        std::vector<NetworkID> networkIDs;
+
+        size_t Size() const { return cframes.size(); }
+
+        void Append(BasePart& part) {
+            cframes.push_back(part.cframe);
+            sizes.push_back(part.GetSize());
+            colors.push_back(part.GetColor());
+            surfaces.push_back(PackSurfaces(part));
+            networkIDs.push_back(part.networkID);
+        }
+
+        void Write(uint32_t index, BasePart& part) {
+            cframes[index] = part.cframe;
+            sizes[index] = part.GetSize();
+            colors[index] = part.GetColor();
+            surfaces[index] = PackSurfaces(part);
+            networkIDs[index] = part.networkID;
+        }
+
+        void Clear() {
+            cframes.clear();
+            sizes.clear();
+            colors.clear();
+            surfaces.clear();
+            networkIDs.clear();
+        }
+
+        // Mirrors the swap-remove in Workspace::UnregisterPart
+        void SwapRemove(uint32_t index) {
+            size_t last = cframes.size() - 1;
+            if (index != last) {
+                cframes[index] = cframes[last];
+                sizes[index] = sizes[last];
+                colors[index] = colors[last];
+                surfaces[index] = surfaces[last];
+                networkIDs[index] = networkIDs[last];
+            }
+            cframes.pop_back();
+            sizes.pop_back();
+            colors.pop_back();
+            surfaces.pop_back();
+            networkIDs.pop_back();
+        }
+
+    private:
+        static PartSurfaces PackSurfaces(const BasePart& part) {
+            return {
+                static_cast<uint8_t>(part.frontSurface), static_cast<uint8_t>(part.backSurface),
+                static_cast<uint8_t>(part.leftSurface), static_cast<uint8_t>(part.rightSurface),
+                static_cast<uint8_t>(part.topSurface), static_cast<uint8_t>(part.bottomSurface)
+            };
+        }
+    };
+}
@@ -31,7 +31,7 @@ namespace Nova {
             : Instance(name), playerName(name), playerID(id) {}
 
         std::string GetClassName() const override { return "Player"; }
-        std::string GetName() const override { return playerName; }
+        const std::string& GetName() const override { return playerName; }
 
         std::shared_ptr<Model> GetCharacter() const { return character.lock(); }
         void SetCharacter(std::shared_ptr<Model> model) { character = model; }
@@ -24,7 +24,7 @@ namespace Nova {
         RemoteEvent() : Instance("RemoteEvent") {}
 
         std::string GetClassName() const override { return "RemoteEvent"; }
-        std::string GetName() const override { return m_debugName; }
+        const std::string& GetName() const override { return m_debugName; }
 
         // Client calls this to send to server
         void FireServer();
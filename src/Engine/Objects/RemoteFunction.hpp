@@ -24,7 +24,7 @@ namespace Nova {
         RemoteFunction() : Instance("RemoteFunction") {}
 
         std::string GetClassName() const override { return "RemoteFunction"; }
-        std::string GetName() const override { return m_debugName; }
+        const std::string& GetName() const override { return m_debugName; }
 
         // Client calls this to invoke on server (blocking)
         void InvokeServer();
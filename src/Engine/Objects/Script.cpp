@@ -19,15 +19,21 @@ namespace Nova {
 
         if (m_hasRun || Disabled) return;
 
-        auto dm = GetDataModel();
-        if (dm) {
-            auto workspace = dm->GetService<Workspace>();
-            if (IsDescendantOf(workspace)) {
+        if (IsInWorkspace()) {
+            auto dm = GetDataModel();
+            if (dm->IsBatching()) {
+                dm->QueueScriptRun(std::static_pointer_cast<Script>(shared_from_this()));
+            } else {
                 Run();
             }
         }
     }
 
+    void Script::OnDestroying(DestroyBatch& batch) {
+        // A destroyed script never starts, even if a pending batch queued it
+        m_hasRun = true;
+    }
+
     void Script::Run() {
         if (m_hasRun) return;
 
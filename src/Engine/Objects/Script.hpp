@@ -19,10 +19,11 @@ namespace Nova {
         Script(std::string name = "Script");
 
         void OnAncestorChanged(std::shared_ptr<Instance> instance, std::shared_ptr<Instance> newParent) override;
+        void OnDestroying(DestroyBatch& batch) override;
         virtual void Run();
 
         std::string GetClassName() const override { return "Script"; }
-        std::string GetName() const override { return m_debugName; }
+        const std::string& GetName() const override { return m_debugName; }
 
     private:
         bool m_hasRun = false;
@@ -23,6 +23,6 @@ namespace Nova {
 
         Sky() : Instance("Sky") {}
         std::string GetClassName() const override { return "Sky"; }
-        std::string GetName() const override { return m_debugName; }
+        const std::string& GetName() const override { return m_debugName; }
     };
 }
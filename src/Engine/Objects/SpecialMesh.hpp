@@ -20,6 +20,6 @@ namespace Nova {
 
         SpecialMesh() : Instance("SpecialMesh") {}
         std::string GetClassName() const override { return "SpecialMesh"; }
-        std::string GetName() const override { return m_debugName; }
+        const std::string& GetName() const override { return m_debugName; }
     };
 }
@@ -8,6 +8,7 @@
 
 #pragma once
 #include "Common/MathTypes.hpp"
+#include "Engine/Physics/PartHandle.hpp"
 #include <Jolt/Jolt.h>
 #include <Jolt/Physics/Body/BodyID.h>
 #include <Jolt/Physics/Constraints/Constraint.h>
@@ -22,7 +23,7 @@ namespace Nova {
     struct Assembly {
         JPH::BodyID bodyID;
         BasePart* rootPart = nullptr;
-        std::vector<std::weak_ptr<BasePart>> parts;
+        std::vector<PartHandle> parts;  // Indexed by compound sub-shape user data
         std::unordered_map<BasePart*, CFrame> relativeTransforms;
         bool isStatic = false;
 
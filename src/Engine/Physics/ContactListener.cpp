@@ -12,6 +12,7 @@
 #include <Jolt/Physics/Body/BodyLockMulti.h>
 #include <Jolt/Physics/Collision/Shape/CompoundShape.h>
 #include <iostream>
+#include <optional>
 
 namespace Nova {
 
@@ -36,30 +37,24 @@ namespace Nova {
                (az > 0.999f && ax < 0.01f && ay < 0.01f);
     }
 
-    std::shared_ptr<BasePart> ContactListenerImpl::GetPartFromSubShape(const JPH::Body& body, const JPH::SubShapeID& subShapeID) {
-        std::shared_lock<std::shared_mutex> mapLock(service->mMapsMutex);
+    PartHandle ContactListenerImpl::GetPartFromSubShape(const JPH::Body& body, const JPH::SubShapeID& subShapeID) {
         auto it = service->mBodyToAssembly.find(body.GetID());
-        if (it == service->mBodyToAssembly.end()) return nullptr;
-
-        auto assembly = it->second;
-        if (assembly->parts.empty()) return nullptr;
+        if (it == service->mBodyToAssembly.end()) return PartHandle();
 
+        const auto& parts = it->second->parts;
         uint32_t index = (uint32_t)body.GetShape()->GetSubShapeUserData(subShapeID);
-
-        if (index < assembly->parts.size()) {
-            return assembly->parts[index].lock();
-        }
-        return nullptr;
+        return index < parts.size() ? parts[index] : PartHandle();
     }
 
     JPH::ValidateResult ContactListenerImpl::OnContactValidate(const JPH::Body &inBody1, const JPH::Body &inBody2, JPH::RVec3Arg inBaseOffset, const JPH::CollideShapeResult &inCollisionResult) {
-        auto p1 = GetPartFromSubShape(inBody1, inCollisionResult.mSubShapeID1);
-        auto p2 = GetPartFromSubShape(inBody2, inCollisionResult.mSubShapeID2);
+        std::shared_lock<std::shared_mutex> mapLock(service->mMapsMutex);
+        BasePart* p1 = service->ResolvePart(GetPartFromSubShape(inBody1, inCollisionResult.mSubShapeID1));
+        BasePart* p2 = service->ResolvePart(GetPartFromSubShape(inBody2, inCollisionResult.mSubShapeID2));
 
         if (p1 && p2) {
              std::shared_lock<std::shared_mutex> lock(service->mJoinedPairsMutex);
 
-             PhysicsService::PartPair pair = { reinterpret_cast<uint64_t>(p1.get()), reinterpret_cast<uint64_t>(p2.get()) };
+             PhysicsService::PartPair pair = { reinterpret_cast<uint64_t>(p1), reinterpret_cast<uint64_t>(p2) };
              if (pair.first > pair.second) std::swap(pair.first, pair.second);
 
              if (service->mJoinedPairs.contains(pair)) {
@@ -70,13 +65,19 @@ namespace Nova {
     }
 
     void ContactListenerImpl::OnContactAdded(const JPH::Body &inBody1, const JPH::Body &inBody2, const JPH::ContactManifold &inManifold, JPH::ContactSettings &ioSettings) {
-        auto p1 = GetPartFromSubShape(inBody1, inManifold.mSubShapeID1);
-        auto p2 = GetPartFromSubShape(inBody2, inManifold.mSubShapeID2);
+        // The join request is queued after the map lock drops; mQueueMutex ranks above it
+        std::optional<JointRequest> join;
+        {
+            std::shared_lock<std::shared_mutex> mapLock(service->mMapsMutex);
+            PartHandle h1 = GetPartFromSubShape(inBody1, inManifold.mSubShapeID1);
+            PartHandle h2 = GetPartFromSubShape(inBody2, inManifold.mSubShapeID2);
+            BasePart* p1 = service->ResolvePart(h1);
+            BasePart* p2 = service->ResolvePart(h2);
+            if (!p1 || !p2) return;
 
-        if (p1 && p2) {
             {
                 std::lock_guard<std::mutex> lock(service->mContactMutex);
-                service->mContactBuffer.push_back({ p1, p2 });
+                service->mContactBuffer.push_back({ h1, h2 });
             }
 
             // JOINING LOGIC
@@ -106,7 +107,7 @@ namespace Nova {
                 if (inManifold.mRelativeContactPointsOn1.size() >= 4 && 
                     std::abs(inManifold.mPenetrationDepth) < 0.1f)
                 {
-                    PhysicsService::PartPair pair = { reinterpret_cast<uint64_t>(p1.get()), reinterpret_cast<uint64_t>(p2.get()) };
+                    PhysicsService::PartPair pair = { reinterpret_cast<uint64_t>(p1), reinterpret_cast<uint64_t>(p2) };
                     if (pair.first > pair.second) std::swap(pair.first, pair.second);
 
                     bool alreadyJoined = false;
@@ -115,13 +116,15 @@ namespace Nova {
                         alreadyJoined = service->mJoinedPairs.contains(pair);
                     }
 
-                    if (!alreadyJoined) {
-                        std::lock_guard<std::recursive_mutex> lock(service->mQueueMutex);
-                        service->mPendingAutoJoints.push_back({ p1, p2, s1, s2 });
-                    }
+                    if (!alreadyJoined) join = JointRequest{ h1, h2, s1, s2 };
                 }
             }
         }
+
+        if (join) {
+            std::lock_guard<std::recursive_mutex> lock(service->mQueueMutex);
+            service->mPendingAutoJoints.push_back(*join);
+        }
     }
 
     void JointBreakCollector::AddHit(const JPH::CollideShapeResult &inResult) {
@@ -136,10 +139,12 @@ namespace Nova {
                 index = (uint32_t)body.GetShape()->GetSubShapeUserData(inResult.mSubShapeID2);
             }
 
+            // Runs on the main thread under the physics mutex; nothing else can
+            // release the slot between the unlock and BreakJoints
             if (index < assembly->parts.size()) {
-                if (auto part = assembly->parts[index].lock()) {
+                if (BasePart* part = service->ResolvePart(assembly->parts[index])) {
                     mapLock.unlock();
-                    service->BreakJoints(part.get());
+                    service->BreakJoints(part);
                 }
             }
         }
@@ -11,7 +11,7 @@
 #include <Jolt/Physics/Collision/ContactListener.h>
 #include <Jolt/Physics/Collision/CollideShape.h>
 #include <Jolt/Physics/Collision/Shape/Shape.h>
-#include <memory>
+#include "Engine/Physics/PartHandle.hpp"
 
 namespace Nova {
     class PhysicsService;
@@ -22,7 +22,8 @@ namespace Nova {
         PhysicsService* service;
         ContactListenerImpl(PhysicsService* service) : service(service) {}
 
-        std::shared_ptr<BasePart> GetPartFromSubShape(const JPH::Body& body, const JPH::SubShapeID& subShapeID);
+        // Caller holds service->mMapsMutex (shared is enough)
+        PartHandle GetPartFromSubShape(const JPH::Body& body, const JPH::SubShapeID& subShapeID);
 
         JPH::ValidateResult OnContactValidate(const JPH::Body &inBody1, const JPH::Body &inBody2, JPH::RVec3Arg inBaseOffset, const JPH::CollideShapeResult &inCollisionResult) override;
         void OnContactAdded(const JPH::Body &inBody1, const JPH::Body &inBody2, const JPH::ContactManifold &inManifold, JPH::ContactSettings &ioSettings) override;
@@ -0,0 +1,69 @@
+// Nova Game Engine
+// Copyright (C) 2026  brambora69123
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+#pragma once
+#include <cstdint>
+#include <vector>
+
+namespace Nova {
+    class BasePart;
+
+    // Index + generation into a PartSlotTable. A released slot bumps its
+    // generation, so stale handles resolve to nullptr instead of a reused part.
+    struct PartHandle {
+        static constexpr uint32_t InvalidIndex = UINT32_MAX;
+        uint32_t index = InvalidIndex;
+        uint32_t generation = 0;
+
+        bool IsValid() const { return index != InvalidIndex; }
+        bool operator==(const PartHandle&) const = default;
+    };
+
+    // Plain slot table with no internal synchronisation. PhysicsService only
+    // acquires/releases with mMapsMutex held exclusively and resolves with it
+    // held at least shared, which is what keeps a resolved part alive: the
+    // BasePart destructor has to release its slot under the same lock.
+    class PartSlotTable {
+    public:
+        PartHandle Acquire(BasePart* part) {
+            uint32_t index;
+            if (!mFree.empty()) {
+                index = mFree.back();
+                mFree.pop_back();
+            } else {
+                index = static_cast<uint32_t>(mSlots.size());
+                mSlots.emplace_back();
+            }
+            mSlots[index].part = part;
+            return { index, mSlots[index].generation };
+        }
+
+        void Release(PartHandle handle) {
+            if (!Resolve(handle)) return;
+            Slot& slot = mSlots[handle.index];
+            slot.part = nullptr;
+            slot.generation++;
+            mFree.push_back(handle.index);
+        }
+
+        BasePart* Resolve(PartHandle handle) const {
+            if (handle.index >= mSlots.size()) return nullptr;
+            const Slot& slot = mSlots[handle.index];
+            return slot.generation == handle.generation ? slot.part : nullptr;
+        }
+
+    private:
+        struct Slot {
+            BasePart* part = nullptr;
+            uint32_t generation = 0;
+        };
+
+        std::vector<Slot> mSlots;
+        std::vector<uint32_t> mFree;
+    };
+}
@@ -17,33 +17,43 @@
 namespace Nova {
 
     void PhysicsService::UpdateAssemblies() {
-        std::vector<std::weak_ptr<BasePart>> updates_weak;
+        std::vector<PartHandle> updates;
         {
             std::lock_guard<std::recursive_mutex> lock(mQueueMutex);
-            updates_weak.swap(mPendingAssemblyUpdates);
+            updates.swap(mPendingAssemblyUpdates);
+            // States of restored parts that died without ever registering
+            std::erase_if(mPendingBodyStates, [](const auto& entry) { return entry.second.part.expired(); });
         }
 
-        if (updates_weak.empty()) return;
+        if (updates.empty()) return;
 
         JPH::BodyInterface& bi = physicsSystem->GetBodyInterface();
         std::unordered_set<BasePart*> visited;
 
-        for (auto& wp : updates_weak) {
-            auto startPart = wp.lock();
-            if (!startPart || visited.contains(startPart.get())) continue;
+        for (PartHandle startHandle : updates) {
+            // Discovery and shape building read the parts under the shared lock; the
+            // exclusive sections below re-resolve the handles because parts may be
+            // unregistered (and freed) while no lock is held
+            std::shared_lock<std::shared_mutex> readLock(mMapsMutex);
+            BasePart* startPart = mPartSlots.Resolve(startHandle);
+            if (!startPart || visited.contains(startPart)) continue;
 
             // New component discovery
-            std::vector<std::shared_ptr<BasePart>> component;
-            std::vector<std::shared_ptr<BasePart>> stack = { startPart };
+            std::vector<BasePart*> component;
+            std::vector<PartHandle> componentHandles;
+            std::vector<BasePart*> stack = { startPart };
             bool hasAnchored = false;
-            std::shared_ptr<BasePart> bestRoot = nullptr;
+            BasePart* bestRoot = nullptr;
             float maxVolume = -1.0f;
 
             while (!stack.empty()) {
-                std::shared_ptr<BasePart> p = stack.back();
+                BasePart* p = stack.back();
                 stack.pop_back();
-                if (!visited.insert(p.get()).second) continue;
+                if (!visited.insert(p).second) continue;
+                // Joint endpoints may be parts that never registered here
+                if (mPartSlots.Resolve(p->physicsHandle) != p) continue;
                 component.push_back(p);
+                componentHandles.push_back(p->physicsHandle);
 
                 if (p->anchored) hasAnchored = true;
                 
@@ -55,34 +65,33 @@ namespace Nova {
                 }
 
                 // Traverse rigid joints
-                auto it = mPartToJoints.find(p.get());
+                auto it = mPartToJoints.find(p);
                 if (it != mPartToJoints.end()) {
                     for (auto& weakJoint : it->second) {
                         if (auto joint = weakJoint.lock()) {
-                            if (joint->GetClassName() == "Weld" || joint->GetClassName() == "Snap" || 
-                                joint->GetClassName() == "Glue" || joint->GetClassName() == "AutoJoint") {
+                            if (IsRigidJoint(*joint)) {
                                 auto p0 = joint->Part0.lock();
                                 auto p1 = joint->Part1.lock();
-                                std::shared_ptr<BasePart> other = (p0 == p) ? p1 : p0;
-                                if (other && !visited.contains(other.get())) stack.push_back(other);
+                                BasePart* other = (p0.get() == p) ? p1.get() : p0.get();
+                                if (other && !visited.contains(other)) stack.push_back(other);
                             }
                         }
                     }
                 }
 
-                auto it2 = mPartToAutoJoints.find(p.get());
+                auto it2 = mPartToAutoJoints.find(p);
                 if (it2 != mPartToAutoJoints.end()) {
                     for (auto& req : it2->second) {
-                        auto p0 = req->part1.lock();
-                        auto p1 = req->part2.lock();
-                        std::shared_ptr<BasePart> other = (p0 == p) ? p1 : p0;
-                        if (other && !visited.contains(other.get())) stack.push_back(other);
+                        BasePart* p0 = mPartSlots.Resolve(req->part1);
+                        BasePart* p1 = mPartSlots.Resolve(req->part2);
+                        BasePart* other = (p0 == p) ? p1 : p0;
+                        if (other && !visited.contains(other)) stack.push_back(other);
                     }
                 }
             }
 
             auto assembly = std::make_shared<Assembly>();
-            assembly->rootPart = bestRoot.get();
+            assembly->rootPart = bestRoot;
             assembly->isStatic = hasAnchored;
 
             CFrame rootCF = bestRoot->cframe;
@@ -90,11 +99,11 @@ namespace Nova {
 
             JPH::StaticCompoundShapeSettings compoundSettings;
             uint32_t index = 0;
-            for (auto& p : component) {
-                assembly->parts.push_back(p);
+            assembly->parts = componentHandles;
+            for (BasePart* p : component) {
                 CFrame partCF = p->cframe;
                 CFrame relCF = CFrame::from_mat4(invRoot) * partCF;
-                assembly->relativeTransforms[p.get()] = relCF;
+                assembly->relativeTransforms[p] = relCF;
 
                 glm::vec3 size = p->GetSize();
                 JPH::BoxShapeSettings boxSettings(JPH::Vec3(std::max(0.05f, size.x * 0.5f), std::max(0.05f, size.y * 0.5f), std::max(0.05f, size.z * 0.5f)));
@@ -112,6 +121,7 @@ namespace Nova {
             }
 
             auto shapeResult = compoundSettings.Create();
+            readLock.unlock();
             if (!shapeResult.IsValid()) continue;
 
             std::unordered_set<JointInstance*> jointsToRebuild;
@@ -122,8 +132,9 @@ namespace Nova {
             {
                 std::unique_lock<std::shared_mutex> mapLock(mMapsMutex);
                 std::unordered_set<JPH::BodyID, BodyIDHasher> uniqueOldBodies;
-                for (auto& p : component) {
-                    if (!p->physicsBodyID.IsInvalid()) uniqueOldBodies.insert(p->physicsBodyID);
+                for (PartHandle handle : componentHandles) {
+                    BasePart* p = mPartSlots.Resolve(handle);
+                    if (p && !p->physicsBodyID.IsInvalid()) uniqueOldBodies.insert(p->physicsBodyID);
                 }
 
                 std::unordered_set<JPH::Constraint*> constraintsToRemove;
@@ -145,9 +156,9 @@ namespace Nova {
                 for (auto* constraint : constraintsToRemove) {
                     for (auto& [id, ass] : mBodyToAssembly) {
                         if (ass->attachedConstraints.contains(constraint)) {
-                            for (auto& wp : ass->parts) {
-                                if (auto p = wp.lock()) {
-                                    auto itJ = mPartToJoints.find(p.get());
+                            for (PartHandle handle : ass->parts) {
+                                if (BasePart* p = mPartSlots.Resolve(handle)) {
+                                    auto itJ = mPartToJoints.find(p);
                                     if (itJ != mPartToJoints.end()) {
                                         for (auto& weakJoint : itJ->second) {
                                             if (auto joint = weakJoint.lock()) {
@@ -175,9 +186,11 @@ namespace Nova {
                     mBodyToAssembly.erase(id);
                 }
 
-                for (auto& p : component) {
-                    p->physicsBodyID = JPH::BodyID();
-                    mPartToAssembly.erase(p.get());
+                for (PartHandle handle : componentHandles) {
+                    if (BasePart* p = mPartSlots.Resolve(handle)) {
+                        p->physicsBodyID = JPH::BodyID();
+                        mPartToAssembly.erase(p);
+                    }
                 }
             }
 
@@ -208,13 +221,33 @@ namespace Nova {
                     bi.SetAngularVelocity(body->GetID(), oldAngularVel);
                 }
 
+                // A checkpoint restore hands over the saved motion of the assembly
+                {
+                    std::lock_guard<std::recursive_mutex> lock(mQueueMutex);
+                    if (!mPendingBodyStates.empty()) {
+                        for (BasePart* p : component) {
+                            auto it = mPendingBodyStates.find(p);
+                            if (it == mPendingBodyStates.end() || motionType != JPH::EMotionType::Dynamic) continue;
+                            if (it->second.part.expired()) continue;
+                            auto& state = it->second.state;
+                            bi.SetLinearVelocity(body->GetID(), JPH::Vec3(state.linearVelocity.x, state.linearVelocity.y, state.linearVelocity.z));
+                            bi.SetAngularVelocity(body->GetID(), JPH::Vec3(state.angularVelocity.x, state.angularVelocity.y, state.angularVelocity.z));
+                            if (!state.active) bi.DeactivateBody(body->GetID());
+                            break;
+                        }
+                        for (BasePart* p : component) mPendingBodyStates.erase(p);
+                    }
+                }
+
                 {
                     std::unique_lock<std::shared_mutex> mapLock(mMapsMutex);
                     mBodyToAssembly[body->GetID()] = assembly;
                     mAllActiveBodies.insert(body->GetID());
-                    for (auto& p : component) {
-                        p->physicsBodyID = body->GetID();
-                        mPartToAssembly[p.get()] = assembly;
+                    for (PartHandle handle : componentHandles) {
+                        if (BasePart* p = mPartSlots.Resolve(handle)) {
+                            p->physicsBodyID = body->GetID();
+                            mPartToAssembly[p] = assembly;
+                        }
                     }
                 }
 
@@ -23,40 +23,50 @@ namespace Nova {
 
         JPH::BodyInterface& bi = physicsSystem->GetBodyInterface();
         for (auto& exp : explosions) {
-            std::unordered_set<BasePart*> affectedParts;
-            std::unordered_map<BasePart*, glm::vec3> partImpulses;
+            std::vector<std::pair<PartHandle, glm::vec3>> partImpulses;
 
             {
                 std::shared_lock<std::shared_mutex> mapLock(mMapsMutex);
                 for (auto& [id, assembly] : mBodyToAssembly) {
-                    for (auto& wp : assembly->parts) {
-                        auto p = wp.lock();
+                    for (PartHandle handle : assembly->parts) {
+                        BasePart* p = mPartSlots.Resolve(handle);
                         if (!p) continue;
 
-                        auto itRel = assembly->relativeTransforms.find(p.get());
+                        auto itRel = assembly->relativeTransforms.find(p);
                         if (itRel == assembly->relativeTransforms.end()) continue;
 
                         CFrame worldCF = assembly->rootPart->cframe * itRel->second;
                         float distance = glm::length(worldCF.position - exp.position);
                         if (distance <= exp.radius) {
-                            affectedParts.insert(p.get());
-
                             glm::vec3 direction = (distance > 0.01f) ? glm::normalize(worldCF.position - exp.position) : glm::vec3(0, 1, 0);
                             float impulseMagnitude = exp.pressure * (1.0f - distance / exp.radius) * 5.0f;
-                            partImpulses[p.get()] = direction * impulseMagnitude;
+                            partImpulses.emplace_back(handle, direction * impulseMagnitude);
                         }
                     }
                 }
             }
 
-            for (auto* part : affectedParts) BreakJoints(part);
+            {
+                // Every slot release takes mQueueMutex first, so holding it keeps the
+                // resolved parts alive once the map lock is dropped for BreakJoints
+                std::lock_guard<std::recursive_mutex> lock(mQueueMutex);
+                for (auto& [handle, impulse] : partImpulses) {
+                    BasePart* part;
+                    {
+                        std::shared_lock<std::shared_mutex> mapLock(mMapsMutex);
+                        part = mPartSlots.Resolve(handle);
+                    }
+                    if (part) BreakJoints(part);
+                }
+            }
 
             UpdateAssemblies();
 
             std::shared_lock<std::shared_mutex> mapLock(mMapsMutex);
             std::unordered_set<JPH::BodyID, BodyIDHasher> updatedBodies;
-            for (auto& [p, impulse] : partImpulses) {
-                if (p->physicsBodyID.IsInvalid()) continue;
+            for (auto& [handle, impulse] : partImpulses) {
+                BasePart* p = mPartSlots.Resolve(handle);
+                if (!p || p->physicsBodyID.IsInvalid()) continue;
                 if (bi.GetMotionType(p->physicsBodyID) == JPH::EMotionType::Static) continue;
 
                 auto itAss = mPartToAssembly.find(p);
@@ -89,11 +99,11 @@ namespace Nova {
         for (auto& [id, assembly] : mBodyToAssembly) {
             bool bodyAffected = false;
 
-            for (auto& wp : assembly->parts) {
-                auto p = wp.lock();
+            for (PartHandle handle : assembly->parts) {
+                BasePart* p = mPartSlots.Resolve(handle);
                 if (!p) continue;
 
-                auto itRel = assembly->relativeTransforms.find(p.get());
+                auto itRel = assembly->relativeTransforms.find(p);
                 if (itRel == assembly->relativeTransforms.end()) continue;
 
                 CFrame worldCF = assembly->rootPart->cframe * itRel->second;
@@ -101,7 +111,8 @@ namespace Nova {
 
                 if (distance <= radius) {
                     bodyAffected = true;
-                    affectedParts.push_back({p, distance});
+                    // Handed to the Hit signal, so materialize a reference for Lua
+                    if (auto shared = SharePart(p)) affectedParts.push_back({std::move(shared), distance});
 
                     if (bi.GetMotionType(id) != JPH::EMotionType::Static) {
                         glm::vec3 direction = (distance > 0.01f) ? glm::normalize(worldCF.position - position) : glm::vec3(0, 1, 0);
@@ -40,9 +40,9 @@ namespace Nova {
                 if (!constraint) continue;
                 for (auto& [id, ass] : mBodyToAssembly) {
                     if (ass->attachedConstraints.contains(constraint)) {
-                        for (auto& wp : ass->parts) {
-                            if (auto p = wp.lock()) {
-                                auto itJ = mPartToJoints.find(p.get());
+                        for (PartHandle handle : ass->parts) {
+                            if (BasePart* p = mPartSlots.Resolve(handle)) {
+                                auto itJ = mPartToJoints.find(p);
                                 if (itJ != mPartToJoints.end()) {
                                     for (auto& weakJoint : itJ->second) {
                                         if (auto joint = weakJoint.lock()) {
@@ -61,26 +61,31 @@ namespace Nova {
             }
         }
 
-        for (auto& joint : internalRemovals) {
-            if (joint->physicsConstraint) {
-                physicsSystem->RemoveConstraint(joint->physicsConstraint);
-                joint->physicsConstraint = nullptr;
-            }
-            auto it = std::find(mActiveAutoJoints.begin(), mActiveAutoJoints.end(), joint);
-            if (it != mActiveAutoJoints.end()) {
-                auto p0 = joint->part1.lock();
-                auto p1 = joint->part2.lock();
-                if (p0) {
-                    auto& v = mPartToAutoJoints[p0.get()];
-                    v.erase(std::remove(v.begin(), v.end(), joint), v.end());
-                    mPendingAssemblyUpdates.push_back(p0);
+        // Assembly updates raised here are handed over after the map lock is released;
+        // taking mQueueMutex under mMapsMutex would invert the main thread's lock order
+        std::vector<PartHandle> assemblyUpdates;
+
+        {
+            std::unique_lock<std::shared_mutex> mapLock(mMapsMutex);
+            for (auto& joint : internalRemovals) {
+                if (joint->physicsConstraint) {
+                    physicsSystem->RemoveConstraint(joint->physicsConstraint);
+                    joint->physicsConstraint = nullptr;
                 }
-                if (p1) {
-                    auto& v = mPartToAutoJoints[p1.get()];
-                    v.erase(std::remove(v.begin(), v.end(), joint), v.end());
-                    mPendingAssemblyUpdates.push_back(p1);
+                auto it = std::find(mActiveAutoJoints.begin(), mActiveAutoJoints.end(), joint);
+                if (it != mActiveAutoJoints.end()) {
+                    if (BasePart* p0 = mPartSlots.Resolve(joint->part1)) {
+                        auto& v = mPartToAutoJoints[p0];
+                        v.erase(std::remove(v.begin(), v.end(), joint), v.end());
+                        assemblyUpdates.push_back(joint->part1);
+                    }
+                    if (BasePart* p1 = mPartSlots.Resolve(joint->part2)) {
+                        auto& v = mPartToAutoJoints[p1];
+                        v.erase(std::remove(v.begin(), v.end(), joint), v.end());
+                        assemblyUpdates.push_back(joint->part2);
+                    }
+                    mActiveAutoJoints.erase(it);
                 }
-                mActiveAutoJoints.erase(it);
             }
         }
 
@@ -102,9 +107,14 @@ namespace Nova {
             }
         }
 
-        for (auto& part : toAdd) {
-            part->registeredService = std::static_pointer_cast<PhysicsService>(shared_from_this());
-            mPendingAssemblyUpdates.push_back(part);
+        {
+            // Parts unregistered while still queued lost their slot and are skipped
+            std::shared_lock<std::shared_mutex> mapLock(mMapsMutex);
+            for (auto& part : toAdd) {
+                if (mPartSlots.Resolve(part->physicsHandle) == part.get()) {
+                    assemblyUpdates.push_back(part->physicsHandle);
+                }
+            }
         }
 
         for (auto joint : constraintsToAdd) {
@@ -112,12 +122,14 @@ namespace Nova {
             auto p1 = joint->Part1.lock();
             if (!p0 || !p1) continue;
 
-            if (joint->GetClassName() == "Weld" || joint->GetClassName() == "Snap" || 
-                joint->GetClassName() == "Glue" || joint->GetClassName() == "AutoJoint") {
-                mPartToJoints[p0.get()].push_back(joint);
-                mPartToJoints[p1.get()].push_back(joint);
-                mPendingAssemblyUpdates.push_back(p0);
-                mPendingAssemblyUpdates.push_back(p1);
+            if (IsRigidJoint(*joint)) {
+                {
+                    std::unique_lock<std::shared_mutex> mapLock(mMapsMutex);
+                    mPartToJoints[p0.get()].push_back(joint);
+                    mPartToJoints[p1.get()].push_back(joint);
+                    assemblyUpdates.push_back(p0->physicsHandle);
+                    assemblyUpdates.push_back(p1->physicsHandle);
+                }
                 PartPair pair = { reinterpret_cast<uint64_t>(p0.get()), reinterpret_cast<uint64_t>(p1.get()) };
                 if (pair.first > pair.second) std::swap(pair.first, pair.second);
                 {
@@ -144,7 +156,7 @@ namespace Nova {
                     CFrame rel0 = a0->relativeTransforms.at(p0.get());
                     CFrame rel1 = a1->relativeTransforms.at(p1.get());
 
-                    if (joint->GetClassName() == "Motor" || joint->GetClassName() == "Hinge" || joint->GetClassName() == "VelocityMotor") {
+                    if (IsHingeJoint(*joint)) {
                         JPH::HingeConstraintSettings settings;
                         settings.mSpace = JPH::EConstraintSpace::LocalToBodyCOM;
                         CFrame cf0 = rel0 * joint->c0;
@@ -156,7 +168,7 @@ namespace Nova {
                         settings.mNormalAxis1 = JPH::Vec3(cf0.rotation[1].x, cf0.rotation[1].y, cf0.rotation[1].z);
                         settings.mNormalAxis2 = JPH::Vec3(cf1.rotation[1].x, cf1.rotation[1].y, cf1.rotation[1].z);
                         c = settings.Create(*multiLock.GetBody(0), *multiLock.GetBody(1));
-                        if (c && joint->GetClassName() == "VelocityMotor") {
+                        if (c && joint->IsA<VelocityMotor>()) {
                             auto* h = static_cast<JPH::HingeConstraint*>(c);
                             h->SetMotorState(JPH::EMotorState::Velocity);
                             h->SetTargetAngularVelocity(static_cast<VelocityMotor*>(joint.get())->MaxVelocity);
@@ -174,24 +186,32 @@ namespace Nova {
             }
         }
 
-        for (auto& req : autoJoints) {
-            auto p1 = req.part1.lock();
-            auto p2 = req.part2.lock();
-            if (!p1 || !p2) continue;
-            auto activeReq = std::make_shared<InternalJoint>();
-            activeReq->part1 = req.part1;
-            activeReq->part2 = req.part2;
-            mActiveAutoJoints.push_back(activeReq);
-            mPartToAutoJoints[p1.get()].push_back(activeReq);
-            mPartToAutoJoints[p2.get()].push_back(activeReq);
-            mPendingAssemblyUpdates.push_back(p1);
-            mPendingAssemblyUpdates.push_back(p2);
-            PartPair pair = { reinterpret_cast<uint64_t>(p1.get()), reinterpret_cast<uint64_t>(p2.get()) };
-            if (pair.first > pair.second) std::swap(pair.first, pair.second);
-            {
-                std::unique_lock<std::shared_mutex> lock(mJoinedPairsMutex);
-                mJoinedPairs.insert(pair);
+        {
+            std::unique_lock<std::shared_mutex> mapLock(mMapsMutex);
+            for (auto& req : autoJoints) {
+                BasePart* p1 = mPartSlots.Resolve(req.part1);
+                BasePart* p2 = mPartSlots.Resolve(req.part2);
+                if (!p1 || !p2) continue;
+                auto activeReq = std::make_shared<InternalJoint>();
+                activeReq->part1 = req.part1;
+                activeReq->part2 = req.part2;
+                mActiveAutoJoints.push_back(activeReq);
+                mPartToAutoJoints[p1].push_back(activeReq);
+                mPartToAutoJoints[p2].push_back(activeReq);
+                assemblyUpdates.push_back(req.part1);
+                assemblyUpdates.push_back(req.part2);
+                PartPair pair = { reinterpret_cast<uint64_t>(p1), reinterpret_cast<uint64_t>(p2) };
+                if (pair.first > pair.second) std::swap(pair.first, pair.second);
+                {
+                    std::unique_lock<std::shared_mutex> lock(mJoinedPairsMutex);
+                    mJoinedPairs.insert(pair);
+                }
             }
         }
+
+        if (!assemblyUpdates.empty()) {
+            std::lock_guard<std::recursive_mutex> lock(mQueueMutex);
+            mPendingAssemblyUpdates.insert(mPendingAssemblyUpdates.end(), assemblyUpdates.begin(), assemblyUpdates.end());
+        }
     }
 }
@@ -0,0 +1,208 @@
+// Nova Game Engine
+// Copyright (C) 2026  brambora69123
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+#include "Engine/Reflection/Checkpoint.hpp"
+#include "Engine/Reflection/InstanceSerializer.hpp"
+#include "Engine/Reflection/LevelLoader.hpp"
+#include "Engine/Services/DataModel.hpp"
+#include "Engine/Services/PhysicsService.hpp"
+#include "Engine/Objects/BasePart.hpp"
+#include "Common/BinaryStream.hpp"
+#include "Common/Log.hpp"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <unordered_map>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+namespace Nova {
+    static constexpr uint8_t Magic[4] = { 'N', 'V', 'C', 'K' };
+
+    // Top-level classes holding session state rather than place content. The
+    // engine recreates the services and connecting peers recreate their
+    // Players, so these are left out; every other DataModel child is saved.
+    static constexpr std::string_view RuntimeOnlyClasses[] = {
+        "ScriptContext", "PhysicsService", "NetworkService", "Player"
+    };
+
+    static bool IsRuntimeOnly(const std::string& className) {
+        return std::find(std::begin(RuntimeOnlyClasses), std::end(RuntimeOnlyClasses), className)
+            != std::end(RuntimeOnlyClasses);
+    }
+
+    namespace {
+        struct Snapshot {
+            std::vector<std::shared_ptr<Instance>> roots;
+            std::vector<std::pair<const Instance*, PhysicsService::BodyState>> bodies;
+        };
+
+        bool WriteReplacing(const std::string& path, const std::vector<uint8_t>& bytes) {
+            // Written beside the target and renamed, so a crash never leaves half a checkpoint
+            std::string temp = path + ".tmp";
+            {
+                std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+                out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+                if (!out) return false;
+            }
+            // std::filesystem::rename will not replace an existing file on Windows
+#ifdef _WIN32
+            bool replaced = MoveFileExW(std::filesystem::path(temp).c_str(), std::filesystem::path(path).c_str(),
+                MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+            std::error_code ec;
+            std::filesystem::rename(temp, path, ec);
+            bool replaced = !ec;
+#endif
+            if (!replaced) {
+                std::error_code ignored;
+                std::filesystem::remove(temp, ignored);
+            }
+            return replaced;
+        }
+    }
+
+    bool Checkpoint::Save(DataModel& dataModel, const std::string& path) {
+        if (mSaving) {
+            LOG_WRN("Checkpoint", "Previous checkpoint is still being written, skipping '%s'", path.c_str());
+            return false;
+        }
+        if (mWriter.joinable()) mWriter.join();
+
+        auto snapshot = std::make_unique<Snapshot>();
+        Instance::CloneMap copies;
+        for (auto& child : dataModel.GetChildren()) {
+            if (IsRuntimeOnly(child->GetClassName())) continue;
+            if (auto copy = child->Clone(copies)) snapshot->roots.push_back(std::move(copy));
+        }
+
+        // Clones keep references that leave the copied trees pointing at the live
+        // world. The writer must never hold those, or it could drop the last
+        // reference to a world instance off the main thread. The serializer
+        // writes them as none anyway.
+        std::unordered_set<const Instance*> copied;
+        copied.reserve(copies.size());
+        for (auto& [source, copy] : copies) copied.insert(copy);
+        for (auto& [source, copy] : copies) {
+            auto* desc = copy->GetDescriptor();
+            if (!desc) continue;
+            for (auto& reference : desc->flatReferences) {
+                auto target = reference.accessor->get(copy);
+                if (target && !copied.contains(target.get())) reference.accessor->set(copy, nullptr);
+            }
+        }
+
+        // One state per body; the physics thread is held off while they are read
+        if (auto physics = dataModel.FindService<PhysicsService>()) {
+            std::lock_guard<std::recursive_mutex> lock(physics->GetPhysicsMutex());
+            std::unordered_set<JPH::BodyID, PhysicsService::BodyIDHasher> seen;
+            for (auto& [source, copy] : copies) {
+                if (!source->IsA<BasePart>()) continue;
+                auto* part = static_cast<const BasePart*>(source);
+                if (part->physicsBodyID.IsInvalid() || !seen.insert(part->physicsBodyID).second) continue;
+
+                PhysicsService::BodyState state;
+                if (physics->CaptureBodyState(part, state)) snapshot->bodies.emplace_back(copy, state);
+            }
+        }
+
+        mSaving = true;
+        mWriter = std::thread([this, snapshot = std::move(snapshot), path]() mutable {
+            std::unordered_map<const Instance*, uint32_t> indices;
+            std::vector<uint8_t> place = InstanceSerializer::Serialize(snapshot->roots, &indices);
+
+            BinaryWriter out;
+            out.Reserve(place.size() + snapshot->bodies.size() * 32 + 16);
+            out.WriteBytes(Magic, sizeof(Magic));
+            out.WriteVarUInt(Version);
+            out.WriteVarUInt(place.size());
+            out.WriteBytes(place.data(), place.size());
+            out.WriteVarUInt(snapshot->bodies.size());
+            for (auto& [inst, state] : snapshot->bodies) {
+                out.WriteVarUInt(indices.at(inst));
+                out.WriteVec3(state.linearVelocity);
+                out.WriteVec3(state.angularVelocity);
+                out.WriteU8(state.active ? 1 : 0);
+            }
+
+            if (WriteReplacing(path, out.GetData())) {
+                LOG_INF("Checkpoint", "Wrote '%s' (%zu bytes, %zu bodies)", path.c_str(), out.Size(), snapshot->bodies.size());
+            } else {
+                LOG_ERR("Checkpoint", "Cannot write '%s'", path.c_str());
+            }
+
+            // The copies are released here rather than on the main thread
+            snapshot.reset();
+            mSaving = false;
+        });
+        return true;
+    }
+
+    void Checkpoint::Wait() {
+        if (mWriter.joinable()) mWriter.join();
+    }
+
+    bool Checkpoint::IsCheckpoint(const uint8_t* data, size_t size) {
+        return size >= sizeof(Magic) && std::memcmp(data, Magic, sizeof(Magic)) == 0;
+    }
+
+    bool Checkpoint::Restore(const uint8_t* data, size_t size, std::shared_ptr<Instance> root) {
+        if (!IsCheckpoint(data, size)) {
+            LOG_ERR("Checkpoint", "Not a Nova checkpoint");
+            return false;
+        }
+
+        BinaryReader in(data + sizeof(Magic), size - sizeof(Magic));
+        uint64_t version = in.ReadVarUInt();
+        if (version != Version) {
+            LOG_ERR("Checkpoint", "Unsupported checkpoint version %llu", static_cast<unsigned long long>(version));
+            return false;
+        }
+
+        uint64_t placeSize = in.ReadVarUInt();
+        if (in.Failed() || placeSize > in.Remaining()) {
+            LOG_ERR("Checkpoint", "Corrupt checkpoint header");
+            return false;
+        }
+        const uint8_t* place = data + sizeof(Magic) + in.GetPosition();
+        in.Skip(placeSize);
+
+        std::vector<std::shared_ptr<Instance>> instances;
+        auto items = InstanceSerializer::Deserialize(place, placeSize, &instances);
+        if (items.empty()) return false;
+
+        // Queued before the parts register, so their first body picks the state up
+        auto dataModel = std::dynamic_pointer_cast<DataModel>(root);
+        auto physics = dataModel ? dataModel->GetService<PhysicsService>() : nullptr;
+        uint64_t bodyCount = in.ReadVarUInt();
+        for (uint64_t i = 0; i < bodyCount && !in.Failed(); i++) {
+            uint64_t index = in.ReadVarUInt();
+            PhysicsService::BodyState state;
+            state.linearVelocity = in.ReadVec3();
+            state.angularVelocity = in.ReadVec3();
+            state.active = in.ReadU8() != 0;
+            if (!physics || in.Failed() || index >= instances.size()) continue;
+            if (auto& inst = instances[index]; inst && inst->IsA<BasePart>()) {
+                physics->QueueBodyState(std::static_pointer_cast<BasePart>(inst), state);
+            }
+        }
+        if (in.Failed()) LOG_WRN("Checkpoint", "Truncated body states, restoring the place only");
+
+        LevelLoader::AttachPlace(items, root);
+        return true;
+    }
+}
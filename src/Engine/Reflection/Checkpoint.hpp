@@ -0,0 +1,58 @@
+// Nova Game Engine
+// Copyright (C) 2026  brambora69123
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace Nova {
+    class DataModel;
+    class Instance;
+
+    // Point-in-time copy of a running world: every top-level item of the
+    // DataModel except the runtime-only ones (ScriptContext, PhysicsService,
+    // NetworkService and connected Players, see Checkpoint.cpp), plus the
+    // motion of every dynamic physics body.
+    //
+    // Save clones the tree and reads the body states under the physics lock on
+    // the calling thread; encoding and writing the file happen on a background
+    // thread. LevelLoader::Load recognises checkpoints by their header and
+    // restores them like a binary place, queueing each body state on the part
+    // so the rebuilt bodies carry on where they left off.
+    //
+    // Layout (integers are varints, see BinaryStream.hpp):
+    //   "NVCK" version placeSize place[placeSize] (an InstanceSerializer stream)
+    //   bodyCount { instance (stream index) linearVelocity angularVelocity active }
+    class Checkpoint {
+    public:
+        static constexpr uint32_t Version = 1;
+
+        Checkpoint() = default;
+        ~Checkpoint() { Wait(); }
+
+        Checkpoint(const Checkpoint&) = delete;
+        Checkpoint& operator=(const Checkpoint&) = delete;
+
+        // Call on the main thread. Returns false while the previous save is still
+        // being written; the file is replaced atomically once the write finishes.
+        bool Save(DataModel& dataModel, const std::string& path);
+        bool IsSaving() const { return mSaving; }
+        void Wait();
+
+        static bool IsCheckpoint(const uint8_t* data, size_t size);
+        static bool Restore(const uint8_t* data, size_t size, std::shared_ptr<Instance> root);
+
+    private:
+        std::thread mWriter;
+        std::atomic<bool> mSaving = false;
+    };
+}
@@ -7,10 +7,11 @@
 // (at your option) any later version.
 
 #include "Engine/Reflection/ClassDescriptor.hpp"
+#include "Common/Log.hpp"
 
 namespace Nova {
-    std::map<std::string, std::shared_ptr<ClassDescriptor>>& ClassDescriptor::GetAll() {
-        static std::map<std::string, std::shared_ptr<ClassDescriptor>> registry;
+    std::unordered_map<std::string, std::shared_ptr<ClassDescriptor>>& ClassDescriptor::GetAll() {
+        static std::unordered_map<std::string, std::shared_ptr<ClassDescriptor>> registry;
         return registry;
     }
 
@@ -31,5 +32,62 @@ namespace Nova {
                 }
             }
         }
+
+        for (auto& [name, desc] : all) {
+            if (desc->classID >= MaxClasses) {
+                LOG_ERR("Reflection", "Class '%s' has ID %zu, past the ancestry bitset width (%zu); "
+                    "IsA falls back to a slow walk, raise ClassDescriptor::MaxClasses",
+                    name.c_str(), static_cast<size_t>(desc->classID), MaxClasses);
+                continue;
+            }
+            desc->ancestry.reset();
+            for (auto* current = desc.get(); current; current = current->baseClass) {
+                if (current->classID < MaxClasses) desc->ancestry.set(current->classID);
+            }
+        }
+
+        for (auto& [name, desc] : all) {
+            std::vector<const ClassDescriptor*> chain;
+            for (auto* current = desc.get(); current; current = current->baseClass) {
+                chain.push_back(current);
+            }
+            desc->flatProperties.clear();
+            desc->flatMethods.clear();
+            desc->flatSignals.clear();
+            desc->replicatedIDs.clear();
+            desc->flatReferences.clear();
+            desc->members.clear();
+
+            // Base first; later insertions take over the name, so a derived class
+            // shadows its bases and, per class, properties beat methods beat signals
+            for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+                const ClassDescriptor* owner = *it;
+                for (auto& [sigName, signal] : owner->signals) {
+                    desc->members[sigName] = { MemberRef::Kind::Signal, static_cast<uint16_t>(desc->flatSignals.size()) };
+                    desc->flatSignals.push_back(&signal);
+                }
+                for (auto& [methodName, method] : owner->methods) {
+                    desc->members[methodName] = { MemberRef::Kind::Method, static_cast<uint16_t>(desc->flatMethods.size()) };
+                    desc->flatMethods.push_back(&method);
+                }
+                for (auto& [propName, accessor] : owner->properties) {
+                    auto id = static_cast<PropertyID>(desc->flatProperties.size());
+                    bool replicated = owner->replicatedProperties.contains(propName);
+                    desc->members[propName] = { MemberRef::Kind::Property, id };
+                    desc->flatProperties.push_back({ propName, accessor.get(), replicated });
+                }
+                for (auto& [refName, accessor] : owner->references) {
+                    desc->flatReferences.push_back({ refName, accessor.get() });
+                }
+            }
+
+            // A shadowed property keeps its slot but no longer replicates under its name
+            for (PropertyID id = 0; id < desc->flatProperties.size(); id++) {
+                auto& property = desc->flatProperties[id];
+                if (property.replicated && desc->FindPropertyID(property.name) == id) {
+                    desc->replicatedIDs.push_back(id);
+                }
+            }
+        }
     }
 }
@@ -10,26 +10,27 @@
 #include <string>
 #include <map>
 #include <set>
+#include <string_view>
+#include <unordered_map>
+#include <bitset>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <utility>
 #include <memory>
 #include <functional>
 #include <iostream>
 #include "Common/PropertyValue.hpp"
 #include "Engine/Common/Signal.hpp"
-
-#include <lua.h>
-#include <lualib.h>
-#ifndef LUABRIDGE_USING_LUAU
-#define LUABRIDGE_USING_LUAU
-#endif
-#undef lua_rawgetp
-#undef lua_rawsetp
-#include <LuaBridge/LuaBridge.h>
+#include "Engine/Reflection/TypeMarshaling.hpp"
+#include "Common/BinaryStream.hpp"
 
 namespace Nova {
     class Instance;
 
-    // Property kind enum for type-erased access
-    enum class PropertyKind {
+    // Property kind enum for type-erased access. Values are part of the binary format.
+    enum class PropertyKind : uint8_t {
         Bool, Int, Float, String,
         Vector3, CFrame, Color3
     };
@@ -40,6 +41,48 @@ namespace Nova {
         virtual PropertyKind kind() const = 0;
         virtual PropertyValue get(const Instance* inst) const = 0;
         virtual bool set(Instance* inst, const PropertyValue& value) const = 0;
+        // Direct member copy between two instances of the owning class
+        virtual void copy(const Instance* from, Instance* to) const = 0;
+        // Typed Lua conversion straight from/to the member, no PropertyValue in between.
+        // push always leaves one value on the stack; check returns false on a type mismatch.
+        virtual void push(lua_State* L, const Instance* inst) const = 0;
+        virtual bool check(lua_State* L, int idx, Instance* inst) const = 0;
+        // Binary encoding of the member, laid out as BinaryWriter::Write does for kind()
+        virtual void write(BinaryWriter& out, const Instance* inst) const = 0;
+        virtual void read(BinaryReader& in, Instance* inst) const = 0;
+        // Typed assignment for loaders that decode text straight to values. value points
+        // to a bool, int64_t, float, std::string_view, Vector3, CFrame or Color3 as
+        // given by from, and is converted the way set() converts.
+        virtual bool assign(Instance* inst, PropertyKind from, const void* value) const = 0;
+    };
+
+    // Type-erased accessor for a reference to another Instance (weak_ptr/shared_ptr member)
+    struct IReferenceAccessor {
+        virtual ~IReferenceAccessor() = default;
+        virtual std::shared_ptr<Instance> get(const Instance* inst) const = 0;
+        // Fails if the target is not of the member's class; nullptr clears
+        virtual bool set(Instance* inst, const std::shared_ptr<Instance>& target) const = 0;
+    };
+
+    template<typename T, typename Ptr>
+    class ReferenceAccessor : public IReferenceAccessor {
+        using Target = typename Ptr::element_type;
+        Ptr T::* member;
+    public:
+        explicit ReferenceAccessor(Ptr T::* m) : member(m) {}
+
+        std::shared_ptr<Instance> get(const Instance* inst) const override {
+            const Ptr& ref = static_cast<const T*>(inst)->*member;
+            if constexpr (std::is_same_v<Ptr, std::weak_ptr<Target>>) return ref.lock();
+            else return ref;
+        }
+
+        bool set(Instance* inst, const std::shared_ptr<Instance>& target) const override {
+            auto typed = std::dynamic_pointer_cast<Target>(target);
+            if (target && !typed) return false;
+            static_cast<T*>(inst)->*member = typed;
+            return true;
+        }
     };
 
     // Typed property accessor using member pointers
@@ -67,7 +110,54 @@ namespace Nova {
             return false;
         }
 
+        void copy(const Instance* from, Instance* to) const override {
+            static_cast<T*>(to)->*member = static_cast<const T*>(from)->*member;
+        }
+
+        void push(lua_State* L, const Instance* inst) const override {
+            pushLuaValue(L, static_cast<const T*>(inst)->*member);
+        }
+
+        bool check(lua_State* L, int idx, Instance* inst) const override {
+            return readLuaValue(L, idx, static_cast<T*>(inst)->*member);
+        }
+
+        void write(BinaryWriter& out, const Instance* inst) const override {
+            out.Write(static_cast<const T*>(inst)->*member);
+        }
+
+        void read(BinaryReader& in, Instance* inst) const override {
+            in.Read(static_cast<T*>(inst)->*member);
+        }
+
+        bool assign(Instance* inst, PropertyKind from, const void* value) const override {
+            U& target = static_cast<T*>(inst)->*member;
+            switch (from) {
+                case PropertyKind::Bool: return assignValue(target, *static_cast<const bool*>(value));
+                case PropertyKind::Int: return assignValue(target, *static_cast<const int64_t*>(value));
+                case PropertyKind::Float: return assignValue(target, *static_cast<const float*>(value));
+                case PropertyKind::String: return assignValue(target, *static_cast<const std::string_view*>(value));
+                case PropertyKind::Vector3: return assignValue(target, *static_cast<const Vector3*>(value));
+                case PropertyKind::CFrame: return assignValue(target, *static_cast<const CFrame*>(value));
+                case PropertyKind::Color3: return assignValue(target, *static_cast<const Color3*>(value));
+            }
+            return false;
+        }
+
     private:
+        template<typename V>
+        static bool assignValue(U& target, const V& v) {
+            constexpr bool numericU = std::is_arithmetic_v<U> && !std::is_same_v<U, bool>;
+            constexpr bool numericV = std::is_arithmetic_v<V> && !std::is_same_v<V, bool>;
+            if constexpr (std::is_same_v<U, V>) target = v;
+            else if constexpr (std::is_same_v<U, std::string> && std::is_same_v<V, std::string_view>) target.assign(v);
+            else if constexpr (numericU && numericV) target = static_cast<U>(v);
+            else if constexpr (std::is_same_v<U, bool> && std::is_same_v<V, int64_t>) target = v != 0;
+            else if constexpr (std::is_enum_v<U> && std::is_same_v<V, int64_t>) target = static_cast<U>(v);
+            else return false;
+            return true;
+        }
+
         template<typename V>
         static PropertyValue toPropertyValue(const V& v) {
             if constexpr (std::is_same_v<V, bool>) return PropertyValue(v);
@@ -109,7 +199,7 @@ namespace Nova {
                 return std::nullopt;
             }
             else if constexpr (std::is_same_v<V, std::string>) {
-                if (v.isString()) return v.toString();
+                if (v.isString()) return std::string(v.toString());
                 return std::nullopt;
             }
             else if constexpr (std::is_same_v<V, Vector3>) {
@@ -132,10 +222,28 @@ namespace Nova {
         }
     };
 
-    // Method descriptor — a Lua-callable function bound to an Instance
+    // Method descriptor — a Lua-callable function bound to an Instance.
+    // invoke is a per-signature thunk generated by ClassDescriptorBuilder::Method;
+    // the member function pointer itself is stored inline in target.
     struct MethodDescriptor {
         std::string name;
-        std::function<int(lua_State*, Instance*)> call;
+        int (*invoke)(lua_State* L, Instance* inst, const MethodDescriptor& method) = nullptr;
+        alignas(void*) unsigned char target[4 * sizeof(void*)] = {};
+
+        int call(lua_State* L, Instance* inst) const { return invoke(L, inst, *this); }
+
+        template<typename Func>
+        void SetTarget(Func func) {
+            static_assert(sizeof(Func) <= sizeof(target) && std::is_trivially_copyable_v<Func>);
+            std::memcpy(target, &func, sizeof(Func));
+        }
+
+        template<typename Func>
+        Func GetTarget() const {
+            Func func;
+            std::memcpy(&func, target, sizeof(Func));
+            return func;
+        }
     };
 
     // Signal descriptor — extracts a Signal* from an Instance
@@ -144,65 +252,144 @@ namespace Nova {
         std::function<Signal*(Instance*)> getter;
     };
 
+    using ClassID = uint16_t;
+
+    // Index into ClassDescriptor::flatProperties. Base-class properties come first,
+    // so a property keeps its ID in every derived class.
+    using PropertyID = uint16_t;
+    static constexpr PropertyID InvalidPropertyID = UINT16_MAX;
+
+    // Heterogeneous hash so member lookups can take a string_view straight from Lua
+    struct MemberNameHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view name) const { return std::hash<std::string_view>{}(name); }
+    };
+
+    // Entry in the flattened member table: which flat list, and the index into it
+    struct MemberRef {
+        enum class Kind : uint8_t { Property, Method, Signal };
+        Kind kind;
+        uint16_t index;
+    };
+
     // Runtime class metadata
     class ClassDescriptor {
     public:
+        static constexpr size_t MaxClasses = 128;
+
         std::string className;
         std::string baseClassName;
         ClassDescriptor* baseClass = nullptr; // Resolved after registration
 
+        ClassID classID = 0;                  // Dense, assigned in registration order
+        std::bitset<MaxClasses> ancestry;     // Bit set for this class and every base (resolved)
+
         std::map<std::string, std::shared_ptr<IPropertyAccessor>> properties;
         std::map<std::string, MethodDescriptor> methods;
         std::map<std::string, SignalDescriptor> signals;
         std::set<std::string> replicatedProperties;  // Properties that replicate over network
+        std::map<std::string, std::shared_ptr<IReferenceAccessor>> references;
 
-        // Walk inheritance chain to find a property
-        const IPropertyAccessor* FindProperty(const std::string& name) const {
-            const ClassDescriptor* current = this;
-            while (current) {
-                auto it = current->properties.find(name);
-                if (it != current->properties.end()) return it->second.get();
-                current = current->baseClass;
-            }
-            return nullptr;
+        // Flattened tables, rebuilt by ResolveInheritance. Inherited members come
+        // first, so IDs are stable down the hierarchy; the per-class maps above
+        // are only the registration input.
+        struct FlatProperty {
+            std::string name;
+            const IPropertyAccessor* accessor;
+            bool replicated;
+        };
+        std::vector<FlatProperty> flatProperties;
+        std::vector<const MethodDescriptor*> flatMethods;
+        std::vector<const SignalDescriptor*> flatSignals;
+        std::vector<PropertyID> replicatedIDs;  // Replicated subset of flatProperties, in ID order
+
+        // References are few per class and not visible to Lua, so they are
+        // looked up by scanning rather than through members
+        struct FlatReference {
+            std::string name;
+            const IReferenceAccessor* accessor;
+        };
+        std::vector<FlatReference> flatReferences;
+
+        // Name -> member, derived classes shadowing bases. Within one class a
+        // property shadows a method, which shadows a signal.
+        std::unordered_map<std::string, MemberRef, MemberNameHash, std::equal_to<>> members;
+
+        const MemberRef* FindMember(std::string_view name) const {
+            auto it = members.find(name);
+            return it != members.end() ? &it->second : nullptr;
         }
 
-        // Walk inheritance chain to find a method
-        const MethodDescriptor* FindMethod(const std::string& name) const {
-            const ClassDescriptor* current = this;
-            while (current) {
-                auto it = current->methods.find(name);
-                if (it != current->methods.end()) return &it->second;
-                current = current->baseClass;
-            }
-            return nullptr;
+        PropertyID FindPropertyID(std::string_view name) const {
+            auto* member = FindMember(name);
+            return member && member->kind == MemberRef::Kind::Property ? member->index : InvalidPropertyID;
+        }
+
+        const IPropertyAccessor* GetProperty(PropertyID id) const {
+            return id < flatProperties.size() ? flatProperties[id].accessor : nullptr;
+        }
+
+        const std::string& GetPropertyName(PropertyID id) const { return flatProperties[id].name; }
+
+        bool IsReplicated(PropertyID id) const {
+            return id < flatProperties.size() && flatProperties[id].replicated;
+        }
+
+        const IPropertyAccessor* FindProperty(std::string_view name) const {
+            return GetProperty(FindPropertyID(name));
+        }
+
+        const MethodDescriptor* FindMethod(std::string_view name) const {
+            auto* member = FindMember(name);
+            return member && member->kind == MemberRef::Kind::Method ? flatMethods[member->index] : nullptr;
+        }
+
+        const SignalDescriptor* FindSignal(std::string_view name) const {
+            auto* member = FindMember(name);
+            return member && member->kind == MemberRef::Kind::Signal ? flatSignals[member->index] : nullptr;
         }
 
-        // Walk inheritance chain to find a signal
-        const SignalDescriptor* FindSignal(const std::string& name) const {
-            const ClassDescriptor* current = this;
-            while (current) {
-                auto it = current->signals.find(name);
-                if (it != current->signals.end()) return &it->second;
-                current = current->baseClass;
+        const IReferenceAccessor* FindReference(std::string_view name) const {
+            // Last match wins, so a derived class shadows its bases
+            for (auto it = flatReferences.rbegin(); it != flatReferences.rend(); ++it) {
+                if (it->name == name) return it->accessor;
             }
             return nullptr;
         }
 
-        bool IsA(const std::string& className) const {
-            const ClassDescriptor* current = this;
-            while (current) {
-                if (current->className == className) return true;
-                current = current->baseClass;
+        bool IsA(const ClassDescriptor* other) const {
+            if (!other) return false;
+            if (classID < MaxClasses && other->classID < MaxClasses) return ancestry[other->classID];
+            // Past the bitset width (logged at registration): walk the chain instead
+            for (auto* current = this; current; current = current->baseClass) {
+                if (current == other) return true;
             }
             return false;
         }
 
-        static std::map<std::string, std::shared_ptr<ClassDescriptor>>& GetAll();
+        bool IsA(const std::string& className) const {
+            return IsA(Get(className));
+        }
+
+        static std::unordered_map<std::string, std::shared_ptr<ClassDescriptor>>& GetAll();
         static ClassDescriptor* Get(const std::string& name);
         static void ResolveInheritance();
+
+        // Descriptor registered for a C++ type, or nullptr
+        template<typename T>
+        static const ClassDescriptor* Of();
+    };
+
+    template<typename T>
+    struct ClassRegistration {
+        static inline ClassDescriptor* descriptor = nullptr;
     };
 
+    template<typename T>
+    const ClassDescriptor* ClassDescriptor::Of() {
+        return ClassRegistration<T>::descriptor;
+    }
+
     void RegisterClasses();
 
     // Fluent builder for class registration
@@ -211,10 +398,13 @@ namespace Nova {
         std::shared_ptr<ClassDescriptor> desc;
     public:
         ClassDescriptorBuilder(const std::string& name, const std::string& base = "") {
+            auto& all = ClassDescriptor::GetAll();
             desc = std::make_shared<ClassDescriptor>();
             desc->className = name;
             desc->baseClassName = base;
-            ClassDescriptor::GetAll()[name] = desc;
+            desc->classID = static_cast<ClassID>(all.size());
+            all[name] = desc;
+            ClassRegistration<T>::descriptor = desc.get();
         }
 
         template<typename U>
@@ -222,7 +412,7 @@ namespace Nova {
             PropertyKind k;
             using Raw = std::remove_cv_t<std::remove_reference_t<U>>;
             if constexpr (std::is_same_v<Raw, bool>) k = PropertyKind::Bool;
-            else if constexpr (std::is_integral_v<Raw>) k = PropertyKind::Int;
+            else if constexpr (std::is_integral_v<Raw> || std::is_enum_v<Raw>) k = PropertyKind::Int;
             else if constexpr (std::is_floating_point_v<Raw>) k = PropertyKind::Float;
             else if constexpr (std::is_same_v<Raw, std::string>) k = PropertyKind::String;
             else if constexpr (std::is_same_v<Raw, Vector3>) k = PropertyKind::Vector3;
@@ -234,25 +424,29 @@ namespace Nova {
             return *this;
         }
 
+        // Reference to another Instance, resolved by the loaders and remapped by Clone
+        template<typename Ptr>
+        ClassDescriptorBuilder& Reference(const std::string& name, Ptr T::* member) {
+            desc->references[name] = std::make_shared<ReferenceAccessor<T, Ptr>>(member);
+            return *this;
+        }
+
         // Mark a property for network replication
         ClassDescriptorBuilder& Replicated(const std::string& name) {
             desc->replicatedProperties.insert(name);
             return *this;
         }
 
-        // Method binding: void(T::*)()
+        // Method binding for any signature. Arguments are read off the stack
+        // after self (scripts call methods with ':'), results are pushed back.
         template<typename Ret, typename... Args>
         ClassDescriptorBuilder& Method(const std::string& name, Ret(T::*func)(Args...)) {
-            desc->methods[name] = {name, [func](lua_State* L, Instance* inst) -> int {
-                auto* obj = static_cast<T*>(inst);
-                if constexpr (std::is_void_v<Ret>) {
-                    // Need to pop args from stack and call
-                    return callLuaMethod(L, obj, func);
-                } else {
-                    return callLuaMethod(L, obj, func);
-                }
-            }};
-            return *this;
+            return AddMethod<decltype(func), Ret, Args...>(name, func);
+        }
+
+        template<typename Ret, typename... Args>
+        ClassDescriptorBuilder& Method(const std::string& name, Ret(T::*func)(Args...) const) {
+            return AddMethod<decltype(func), Ret, Args...>(name, func);
         }
 
         // Signal binding
@@ -266,42 +460,43 @@ namespace Nova {
         }
 
     private:
-        // Lua method call helpers
-        template<typename Ret, typename... Args>
-        static int callLuaMethod(lua_State* L, T* obj, Ret(T::*func)(Args...)) {
-            if constexpr (sizeof...(Args) == 0 && std::is_void_v<Ret>) {
-                (obj->*func)();
+        template<typename Func, typename Ret, typename... Args>
+        ClassDescriptorBuilder& AddMethod(const std::string& name, Func func) {
+            MethodDescriptor& method = desc->methods[name];
+            method.name = name;
+            method.invoke = &InvokeMethod<Func, Ret, Args...>;
+            method.SetTarget(func);
+            return *this;
+        }
+
+        template<typename Func, typename Ret, typename... Args>
+        static int InvokeMethod(lua_State* L, Instance* inst, const MethodDescriptor& method) {
+            int result = CallMethod<Func, Ret, Args...>(L, static_cast<T*>(inst), method.GetTarget<Func>(),
+                std::index_sequence_for<Args...>{});
+            // Raised out here so no decoded arguments are live when the error unwinds.
+            // Arguments are numbered from the first one after self.
+            if (result < 0) luaL_error(L, "bad argument #%d to '%s'", -result - 1, method.name.c_str());
+            return result;
+        }
+
+        // Number of results pushed, or minus the stack index of the first bad argument
+        template<typename Func, typename Ret, typename... Args, size_t... I>
+        static int CallMethod(lua_State* L, T* obj, Func func, std::index_sequence<I...>) {
+            std::tuple<std::remove_cv_t<std::remove_reference_t<Args>>...> args;
+            int badArg = 0;
+            [[maybe_unused]] auto read = [&](auto& out, int idx) {
+                if (badArg == 0 && !readLuaValue(L, idx, out)) badArg = idx;
+            };
+            (read(std::get<I>(args), static_cast<int>(I) + 2), ...);
+            if (badArg != 0) return -badArg;
+
+            if constexpr (std::is_void_v<Ret>) {
+                (obj->*func)(std::get<I>(args)...);
                 return 0;
-            }
-            else if constexpr (sizeof...(Args) == 0 && std::is_same_v<Ret, float>) {
-                lua_pushnumber(L, (obj->*func)());
-                return 1;
-            }
-            else if constexpr (sizeof...(Args) == 0 && std::is_same_v<Ret, Vector3>) {
-                luabridge::push(L, (obj->*func)());
+            } else {
+                pushLuaValue(L, (obj->*func)(std::get<I>(args)...));
                 return 1;
             }
-            else if constexpr (sizeof...(Args) == 1 && std::is_void_v<Ret>) {
-                using Arg0 = std::tuple_element_t<0, std::tuple<Args...>>;
-                using RawArg0 = std::remove_cv_t<std::remove_reference_t<Arg0>>;
-                if constexpr (std::is_same_v<RawArg0, float>) {
-                    float arg = static_cast<float>(lua_tonumber(L, 1));
-                    (obj->*func)(arg);
-                    return 0;
-                }
-                else if constexpr (std::is_same_v<RawArg0, Vector3> || std::is_same_v<RawArg0, const Vector3&>) {
-                    // Use LuaBridge to get Vector3 from stack
-                    if (luabridge::Stack<Vector3>::isInstance(L, 1)) {
-                        auto result = luabridge::Stack<Vector3>::get(L, 1);
-                        if (result) {
-                            (obj->*func)(result.value());
-                        }
-                    }
-                    return 0;
-                }
-                return 0;
-            }
-            return 0;
         }
     };
 }
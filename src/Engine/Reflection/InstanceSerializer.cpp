@@ -0,0 +1,270 @@
+// Nova Game Engine
+// Copyright (C) 2026  brambora69123
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+#include "Engine/Reflection/InstanceSerializer.hpp"
+#include "Engine/Reflection/ClassDescriptor.hpp"
+#include "Engine/Objects/Instance.hpp"
+#include "Engine/Objects/InstanceFactory.hpp"
+#include "Common/BinaryStream.hpp"
+#include "Common/Log.hpp"
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+namespace Nova {
+    static constexpr uint8_t Magic[4] = { 'N', 'V', 'S', 'B' };
+
+    namespace {
+        struct Chunk {
+            const ClassDescriptor* desc = nullptr;
+            std::string className;
+            std::vector<uint32_t> indices;
+        };
+
+        // Schema of a class: its properties and references, minus shadowed ones
+        std::vector<const ClassDescriptor::FlatProperty*> SchemaProperties(const ClassDescriptor* desc) {
+            std::vector<const ClassDescriptor::FlatProperty*> schema;
+            if (!desc) return schema;
+            for (PropertyID id = 0; id < desc->flatProperties.size(); id++) {
+                auto& property = desc->flatProperties[id];
+                if (desc->FindPropertyID(property.name) == id) schema.push_back(&property);
+            }
+            return schema;
+        }
+
+        std::vector<const ClassDescriptor::FlatReference*> SchemaReferences(const ClassDescriptor* desc) {
+            std::vector<const ClassDescriptor::FlatReference*> schema;
+            if (!desc) return schema;
+            for (auto& reference : desc->flatReferences) {
+                if (desc->FindReference(reference.name) == reference.accessor) schema.push_back(&reference);
+            }
+            return schema;
+        }
+
+        void SkipValue(BinaryReader& in, PropertyKind kind) {
+            switch (kind) {
+                case PropertyKind::Bool: in.Skip(1); break;
+                case PropertyKind::Int: in.ReadVarUInt(); break;
+                case PropertyKind::Float: in.Skip(sizeof(float)); break;
+                case PropertyKind::String: in.ReadStringView(); break;
+                case PropertyKind::Vector3:
+                case PropertyKind::Color3: in.Skip(3 * sizeof(float)); break;
+                case PropertyKind::CFrame: in.Skip(12 * sizeof(float)); break;
+            }
+        }
+    }
+
+    std::vector<uint8_t> InstanceSerializer::Serialize(const std::vector<std::shared_ptr<Instance>>& roots,
+        std::unordered_map<const Instance*, uint32_t>* indices) {
+        // Pre-order numbering, so every parent precedes its children
+        std::vector<const Instance*> order;
+        std::unordered_map<const Instance*, uint32_t> indexOf;
+        std::vector<const Instance*> stack;
+        for (auto it = roots.rbegin(); it != roots.rend(); ++it) {
+            if (*it) stack.push_back(it->get());
+        }
+        while (!stack.empty()) {
+            const Instance* inst = stack.back();
+            stack.pop_back();
+            if (!indexOf.emplace(inst, static_cast<uint32_t>(order.size())).second) continue;
+            order.push_back(inst);
+            auto& children = inst->GetChildren();
+            for (auto it = children.rbegin(); it != children.rend(); ++it) {
+                stack.push_back(it->get());
+            }
+        }
+
+        // One chunk per class; classes without a descriptor are grouped by name
+        std::vector<Chunk> chunks;
+        std::unordered_map<const ClassDescriptor*, size_t> chunkByDesc;
+        std::unordered_map<std::string, size_t> chunkByName;
+        for (uint32_t i = 0; i < order.size(); i++) {
+            const ClassDescriptor* desc = order[i]->GetDescriptor();
+            size_t chunk;
+            if (desc) {
+                auto [it, inserted] = chunkByDesc.try_emplace(desc, chunks.size());
+                if (inserted) chunks.push_back({ desc, desc->className, {} });
+                chunk = it->second;
+            } else {
+                std::string className = order[i]->GetClassName();
+                auto [it, inserted] = chunkByName.try_emplace(className, chunks.size());
+                if (inserted) chunks.push_back({ nullptr, className, {} });
+                chunk = it->second;
+            }
+            chunks[chunk].indices.push_back(i);
+        }
+
+        BinaryWriter out;
+        out.Reserve(order.size() * 64);
+        out.WriteBytes(Magic, sizeof(Magic));
+        out.WriteVarUInt(Version);
+        out.WriteVarUInt(order.size());
+        out.WriteVarUInt(chunks.size());
+
+        for (auto& chunk : chunks) {
+            out.WriteString(chunk.className);
+            out.WriteVarUInt(chunk.indices.size());
+            uint32_t previous = 0;
+            for (uint32_t index : chunk.indices) {
+                out.WriteVarUInt(index - previous);
+                previous = index;
+            }
+        }
+
+        for (const Instance* inst : order) {
+            out.WriteString(inst->GetName());
+        }
+        for (const Instance* inst : order) {
+            auto parent = inst->GetParent();
+            auto it = parent ? indexOf.find(parent.get()) : indexOf.end();
+            out.WriteVarUInt(it != indexOf.end() ? it->second + 1 : 0);
+        }
+
+        for (auto& chunk : chunks) {
+            auto properties = SchemaProperties(chunk.desc);
+            out.WriteVarUInt(properties.size());
+            for (auto* property : properties) {
+                out.WriteString(property->name);
+                out.WriteU8(static_cast<uint8_t>(property->accessor->kind()));
+                for (uint32_t index : chunk.indices) {
+                    property->accessor->write(out, order[index]);
+                }
+            }
+
+            auto references = SchemaReferences(chunk.desc);
+            out.WriteVarUInt(references.size());
+            for (auto* reference : references) {
+                out.WriteString(reference->name);
+                for (uint32_t index : chunk.indices) {
+                    auto target = reference->accessor->get(order[index]);
+                    auto it = target ? indexOf.find(target.get()) : indexOf.end();
+                    out.WriteVarUInt(it != indexOf.end() ? it->second + 1 : 0);
+                }
+            }
+        }
+
+        if (indices) *indices = std::move(indexOf);
+        return out.TakeData();
+    }
+
+    bool InstanceSerializer::IsStream(const uint8_t* data, size_t size) {
+        return size >= sizeof(Magic) && std::memcmp(data, Magic, sizeof(Magic)) == 0;
+    }
+
+    std::vector<std::shared_ptr<Instance>> InstanceSerializer::Deserialize(const uint8_t* data, size_t size,
+        std::vector<std::shared_ptr<Instance>>* instancesOut) {
+        if (!IsStream(data, size)) {
+            LOG_ERR("Serializer", "Not a Nova instance stream");
+            return {};
+        }
+
+        BinaryReader in(data + sizeof(Magic), size - sizeof(Magic));
+        uint64_t version = in.ReadVarUInt();
+        if (version != Version) {
+            LOG_ERR("Serializer", "Unsupported instance stream version %llu", static_cast<unsigned long long>(version));
+            return {};
+        }
+
+        // Every instance costs at least a name and a parent byte, which bounds the counts
+        uint64_t instanceCount = in.ReadVarUInt();
+        uint64_t chunkCount = in.ReadVarUInt();
+        if (instanceCount > in.Remaining() || chunkCount > instanceCount) {
+            LOG_ERR("Serializer", "Corrupt instance stream header");
+            return {};
+        }
+
+        std::vector<std::shared_ptr<Instance>> instances(instanceCount);
+        std::vector<Chunk> chunks(chunkCount);
+        for (auto& chunk : chunks) {
+            chunk.className = in.ReadString();
+            uint64_t count = in.ReadVarUInt();
+            if (count > instanceCount) return {};
+
+            // Unknown classes decode as placeholder Models so their subtrees and the
+            // references into them survive; their own values are skipped
+            std::string createName = chunk.className;
+            auto prototype = InstanceFactory::Get().Create(createName);
+            if (!prototype) {
+                LOG_WRN("Serializer", "Unknown class '%s', loading %llu instances as %s placeholders",
+                    chunk.className.c_str(), static_cast<unsigned long long>(count), PlaceholderClass);
+                createName = PlaceholderClass;
+                prototype = InstanceFactory::Get().Create(createName);
+                chunk.desc = nullptr;
+            } else {
+                chunk.desc = prototype->GetDescriptor();
+            }
+
+            chunk.indices.resize(count);
+            uint64_t index = 0;
+            for (size_t i = 0; i < count; i++) {
+                index += in.ReadVarUInt();
+                if (index >= instanceCount || instances[index] || in.Failed()) return {};
+                chunk.indices[i] = static_cast<uint32_t>(index);
+                instances[index] = i == 0 ? prototype : InstanceFactory::Get().Create(createName);
+            }
+        }
+
+        for (auto& inst : instances) {
+            std::string_view name = in.ReadStringView();
+            if (!inst) {
+                LOG_ERR("Serializer", "Instance stream leaves instances without a class");
+                return {};
+            }
+            inst->m_debugName.assign(name);
+        }
+
+        // Children are linked directly like Clone does; the trees are not in a DataModel yet
+        std::vector<std::shared_ptr<Instance>> roots;
+        for (uint64_t i = 0; i < instanceCount; i++) {
+            uint64_t parentIndex = in.ReadVarUInt();
+            auto& inst = instances[i];
+            if (parentIndex == 0) {
+                roots.push_back(inst);
+                continue;
+            }
+            if (parentIndex > i) return {};  // Parents precede children
+            auto& parent = instances[parentIndex - 1];
+            inst->parent = parent;
+            parent->children.push_back(inst);
+        }
+
+        for (auto& chunk : chunks) {
+            uint64_t propertyCount = in.ReadVarUInt();
+            for (uint64_t p = 0; p < propertyCount && !in.Failed(); p++) {
+                std::string_view name = in.ReadStringView();
+                auto kind = static_cast<PropertyKind>(in.ReadU8());
+                if (kind > PropertyKind::Color3) return {};
+
+                const IPropertyAccessor* accessor = chunk.desc ? chunk.desc->FindProperty(name) : nullptr;
+                if (accessor && accessor->kind() != kind) accessor = nullptr;
+                for (uint32_t index : chunk.indices) {
+                    if (accessor) accessor->read(in, instances[index].get());
+                    else SkipValue(in, kind);
+                }
+            }
+
+            uint64_t referenceCount = in.ReadVarUInt();
+            for (uint64_t r = 0; r < referenceCount && !in.Failed(); r++) {
+                std::string_view name = in.ReadStringView();
+                const IReferenceAccessor* reference = chunk.desc ? chunk.desc->FindReference(name) : nullptr;
+                for (uint32_t index : chunk.indices) {
+                    uint64_t target = in.ReadVarUInt();
+                    if (!reference || target == 0 || target > instanceCount) continue;
+                    reference->set(instances[index].get(), instances[target - 1]);
+                }
+            }
+        }
+
+        if (in.Failed()) {
+            LOG_ERR("Serializer", "Truncated instance stream");
+            return {};
+        }
+        if (instancesOut) *instancesOut = std::move(instances);
+        return roots;
+    }
+}
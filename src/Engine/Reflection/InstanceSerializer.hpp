@@ -0,0 +1,59 @@
+// Nova Game Engine
+// Copyright (C) 2026  brambora69123
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Nova {
+    class Instance;
+
+    // Reflection-driven binary encoding of instance trees.
+    //
+    // Instances are numbered in pre-order and grouped into one chunk per class.
+    // Each chunk carries its schema (property names and kinds, reference names)
+    // followed by one column of values per property, so decoding resolves every
+    // property once per class and then reads values straight into the members
+    // through the accessors' typed read/write. Properties the running build does
+    // not know, or whose kind changed, are skipped. Instances of classes it does
+    // not know decode as PlaceholderClass, keeping their name and children.
+    //
+    // Places, binary places and checkpoints load through this encoding.
+    // Instance::Clone shares the accessors but copies member to member, since
+    // a clone keeps references that point outside the copied subtree. The
+    // network still sends its own per-instance packets.
+    //
+    // Layout (integers are varints, see BinaryStream.hpp):
+    //   "NVSB" version instanceCount chunkCount
+    //   chunk table:  className count indexDelta[count]
+    //   names[instanceCount]  parents[instanceCount] (index + 1, 0 = root)
+    //   per chunk:    propertyCount { name kind value[count] }
+    //                 referenceCount { name target[count] (index + 1, 0 = none) }
+    class InstanceSerializer {
+    public:
+        static constexpr uint32_t Version = 1;
+        static constexpr const char* PlaceholderClass = "Model";
+
+        // Encodes each root with all of its descendants. References to instances
+        // outside the encoded trees are written as none. indices, if given,
+        // receives the stream index of every encoded instance.
+        static std::vector<uint8_t> Serialize(const std::vector<std::shared_ptr<Instance>>& roots,
+            std::unordered_map<const Instance*, uint32_t>* indices = nullptr);
+
+        // Rebuilds the trees detached from any DataModel and returns the roots in
+        // the order they were written. Returns nothing on malformed input.
+        // instances, if given, receives every instance by stream index.
+        static std::vector<std::shared_ptr<Instance>> Deserialize(const uint8_t* data, size_t size,
+            std::vector<std::shared_ptr<Instance>>* instances = nullptr);
+
+        // True when the buffer starts with the stream magic
+        static bool IsStream(const uint8_t* data, size_t size);
+    };
+}
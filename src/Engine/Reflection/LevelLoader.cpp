@@ -9,30 +9,29 @@
 #include "Engine/Objects/InstanceFactory.hpp"
 #include "Engine/Reflection/LevelLoader.hpp"
 #include "Engine/Reflection/ClassDescriptor.hpp"
+#include "Engine/Reflection/InstanceSerializer.hpp"
+#include "Engine/Reflection/Checkpoint.hpp"
+#include "Common/MappedFile.hpp"
+#include "Common/ParallelFor.hpp"
 #include "Common/MathTypes.hpp"
 #include "Common/Log.hpp"
 #include "Engine/Services/PhysicsService.hpp"
 #include "Engine/Objects/Model.hpp"
 #include <SDL3/SDL_log.h>
-#include <map>
+#include <array>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
 #include <set>
 #include <string>
+#include <string_view>
 #include <pugixml.hpp>
 #include "Engine/Nova.hpp"
 
 namespace Nova {
 
-    void FindAllBaseParts(std::shared_ptr<Instance> inst, std::vector<std::shared_ptr<BasePart>>& out) {
-        if (auto bp = std::dynamic_pointer_cast<BasePart>(inst)) {
-            out.push_back(bp);
-        }
-        for (auto& child : inst->GetChildren()) {
-            FindAllBaseParts(child, out);
-        }
-    }
-
-    std::map<std::string, std::shared_ptr<Instance>> referentMap;
-
     void LevelLoader::PrintInstanceTree(std::shared_ptr<Nova::Instance> instance, int depth) {
         if (!instance) return;
 
@@ -41,7 +40,7 @@ namespace Nova {
                   << instance->GetName() << std::endl;
 
         // Print properties via ClassDescriptor
-        auto* desc = ClassDescriptor::Get(instance->GetClassName());
+        auto* desc = instance->GetDescriptor();
         if (desc) {
             for (auto& [name, accessor] : desc->properties) {
                 if (name == "Name") continue;
@@ -54,12 +53,12 @@ namespace Nova {
                     case PropertyValue::Kind::Float: std::cout << val.toFloat(); break;
                     case PropertyValue::Kind::String: std::cout << "\"" << val.toString() << "\""; break;
                     case PropertyValue::Kind::Vector3: {
-                        auto& v = val.toVector3();
+                        Vector3 v = val.toVector3();
                         std::cout << "Vector3(" << v.x << ", " << v.y << ", " << v.z << ")";
                         break;
                     }
                     case PropertyValue::Kind::CFrame: {
-                        auto& cf = val.toCFrame();
+                        CFrame cf = val.toCFrame();
                         std::cout << "CFrame(" << cf.position.x << ", " << cf.position.y << ", " << cf.position.z << ")";
                         break;
                     }
@@ -78,6 +77,148 @@ namespace Nova {
         }
     }
 
+    // Top-level items of these classes are merged into the existing service
+    static const std::set<std::string, std::less<>> serviceClasses = {
+        "Workspace", "Lighting", "RunService", "Selection", "Debris"
+    };
+
+    // Older files spell some properties differently. Remapped through a perfect
+    // hash over length and first/last character, checked at compile time.
+    struct LegacyName {
+        std::string_view from;
+        std::string_view to;
+    };
+    static constexpr LegacyName legacyNames[] = {
+        { "anchored", "Anchored" }, { "canCollide", "CanCollide" }, { "CoordinateFrame", "CFrame" },
+        { "size", "Size" }, { "archivable", "Archivable" }, { "name", "Name" },
+    };
+
+    static constexpr size_t LegacyNameSlot(std::string_view name) {
+        return (name.size() + static_cast<unsigned char>(name.front()) * 5 + static_cast<unsigned char>(name.back())) & 7;
+    }
+
+    static constexpr auto legacyNameTable = [] {
+        std::array<int8_t, 8> table{};
+        table.fill(-1);
+        for (size_t i = 0; i < std::size(legacyNames); i++) {
+            table[LegacyNameSlot(legacyNames[i].from)] = static_cast<int8_t>(i);
+        }
+        return table;
+    }();
+
+    static_assert([] {
+        for (size_t i = 0; i < std::size(legacyNames); i++) {
+            if (legacyNameTable[LegacyNameSlot(legacyNames[i].from)] != static_cast<int8_t>(i)) return false;
+        }
+        return true;
+    }(), "legacy property names collide in legacyNameTable");
+
+    static std::string_view CanonicalPropertyName(std::string_view name) {
+        if (name.empty()) return name;
+        int8_t entry = legacyNameTable[LegacyNameSlot(name)];
+        return entry >= 0 && legacyNames[entry].from == name ? legacyNames[entry].to : name;
+    }
+
+    // "r,g,b" floats in some files, packed 0xRRGGBB in others
+    static Color3 ParseColor3(const char* text) {
+        if (std::strchr(text, ',')) {
+            float channels[3] = { 0, 0, 0 };
+            for (int i = 0; i < 3; i++) {
+                char* end;
+                channels[i] = std::strtof(text, &end);
+                if (*end != ',') break;
+                text = end + 1;
+            }
+            return Color3(channels[0], channels[1], channels[2]);
+        }
+        auto packed = static_cast<uint32_t>(std::strtoul(text, nullptr, 10));
+        return Color3(
+            (float)((packed >> 16) & 0xFF) / 255.0f,
+            (float)((packed >> 8) & 0xFF) / 255.0f,
+            (float)(packed & 0xFF) / 255.0f
+        );
+    }
+
+    // Decodes one <Properties> child straight to its value and hands it to the typed setter
+    static void AssignXmlProperty(pugi::xml_node prop, std::string_view type, const IPropertyAccessor* accessor, Instance* inst) {
+        if (type == "string") {
+            std::string_view value = prop.text().get();
+            accessor->assign(inst, PropertyKind::String, &value);
+        }
+        else if (type == "bool") {
+            bool value = prop.text().as_bool();
+            accessor->assign(inst, PropertyKind::Bool, &value);
+        }
+        else if (type == "float") {
+            float value = prop.text().as_float();
+            accessor->assign(inst, PropertyKind::Float, &value);
+        }
+        else if (type == "token" || type == "int") {
+            int64_t value = prop.text().as_llong();
+            accessor->assign(inst, PropertyKind::Int, &value);
+        }
+        else if (type == "Vector3") {
+            Vector3 value(0.0f);
+            for (auto component : prop.children()) {
+                const char* name = component.name();
+                if (name[0] >= 'X' && name[0] <= 'Z' && !name[1]) value[name[0] - 'X'] = component.text().as_float();
+            }
+            accessor->assign(inst, PropertyKind::Vector3, &value);
+        }
+        else if (type == "CoordinateFrame") {
+            // One walk over X..Z and R00..R22. XML stores rows (R01 is row 0,
+            // column 1) and GLM stores columns, so Rrc lands in rotation[c][r].
+            CFrame value;
+            for (auto component : prop.children()) {
+                const char* name = component.name();
+                if (name[0] >= 'X' && name[0] <= 'Z' && !name[1]) {
+                    value.position[name[0] - 'X'] = component.text().as_float();
+                } else if (name[0] == 'R' && name[1] >= '0' && name[1] <= '2' && name[2] >= '0' && name[2] <= '2' && !name[3]) {
+                    value.rotation[name[2] - '0'][name[1] - '0'] = component.text().as_float();
+                }
+            }
+            accessor->assign(inst, PropertyKind::CFrame, &value);
+        }
+        else if (type == "Color3") {
+            Color3 value = ParseColor3(prop.text().get());
+            accessor->assign(inst, PropertyKind::Color3, &value);
+        }
+    }
+
+    struct LevelLoader::ReferentTable {
+        explicit ReferentTable(size_t count) {
+            size_t capacity = 16;
+            while (capacity < count * 2) capacity <<= 1;
+            slots.resize(capacity);
+            mask = capacity - 1;
+        }
+
+        void Insert(std::string_view key, const std::shared_ptr<Instance>& inst) {
+            for (size_t i = std::hash<std::string_view>{}(key) & mask;; i = (i + 1) & mask) {
+                if (!slots[i].inst || slots[i].key == key) {
+                    slots[i] = { key, inst };
+                    return;
+                }
+            }
+        }
+
+        const std::shared_ptr<Instance>* Find(std::string_view key) const {
+            for (size_t i = std::hash<std::string_view>{}(key) & mask;; i = (i + 1) & mask) {
+                if (!slots[i].inst) return nullptr;
+                if (slots[i].key == key) return &slots[i].inst;
+            }
+        }
+
+    private:
+        struct Slot {
+            std::string_view key;
+            std::shared_ptr<Instance> inst;
+        };
+        // At most half full, so probes always reach an empty slot
+        std::vector<Slot> slots;
+        size_t mask = 0;
+    };
+
     std::shared_ptr<Nova::Instance> FindService(std::shared_ptr<Nova::Instance> parent, const std::string& className) {
         if (!parent) return nullptr;
         for (auto& child : parent->GetChildren()) {
@@ -89,23 +230,19 @@ namespace Nova {
     }
 
     void LevelLoader::Load(const std::string& path, std::shared_ptr<Instance> dataModel) {
-        pugi::xml_document doc;
-        if (!doc.load_file(path.c_str())) return;
-
-        std::shared_ptr<PhysicsService> physics = nullptr;
-        if (auto dm = std::dynamic_pointer_cast<DataModel>(dataModel)) {
-            physics = dm->GetService<PhysicsService>();
-            if (physics) physics->SetDeferRegistration(true);
-        }
-
-        auto roblox = doc.child("roblox");
-
-        for (auto item : roblox.children("Item")) {
-            ProcessItemPass1(item, dataModel);
-        }
-
-        for (auto item : roblox.children("Item")) {
-            ProcessItemPass2(item);
+        // Copy-on-write, so the XML parser can work in place without touching the file
+        MappedFile file(path, true);
+        if (!file.IsOpen()) return;
+
+        // Parts, joints and scripts register once every property and Ref is resolved
+        DataModel::BatchScope batch(dataModel->GetDataModel());
+
+        if (InstanceSerializer::IsStream(file.Data(), file.Size())) {
+            LoadBinary(file.Data(), file.Size(), dataModel);
+        } else if (Checkpoint::IsCheckpoint(file.Data(), file.Size())) {
+            Checkpoint::Restore(file.Data(), file.Size(), dataModel);
+        } else {
+            LoadXml(file.MutableData(), file.Size(), dataModel);
         }
 
         if (auto dm = std::dynamic_pointer_cast<DataModel>(dataModel)) {
@@ -119,143 +256,149 @@ namespace Nova {
                 }
 
                 if (!workspace->CurrentCamera) {
-                    auto cam = std::make_shared<Camera>();
+                    auto cam = MakePooled<Camera>();
                     cam->SetParent(workspace);
                     workspace->CurrentCamera = cam;
                     LOG_INF("LevelLoader", "No camera found, created default Camera.");
                 }
             }
-
-            workspace->RefreshCachedParts();
         }
+    }
 
-        if (physics) {
-            physics->SetDeferRegistration(false);
-
-            std::vector<std::shared_ptr<BasePart>> parts;
-            FindAllBaseParts(dataModel, parts);
-            for (auto& part : parts) part->InitializePhysics();
+    bool LevelLoader::SaveBinary(const std::string& path, std::shared_ptr<Instance> root) {
+        std::vector<uint8_t> bytes = InstanceSerializer::Serialize(root->GetChildren());
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        if (!out) {
+            LOG_ERR("LevelLoader", "Cannot write '%s'", path.c_str());
+            return false;
         }
-
-        referentMap.clear();
+        return true;
     }
 
-    void LevelLoader::ProcessItemPass1(pugi::xml_node node, std::shared_ptr<Instance> parent) {
-        const char* className = node.attribute("class").value();
-        std::string refId = node.attribute("referent").value();
+    void LevelLoader::LoadXml(uint8_t* data, size_t size, std::shared_ptr<Instance> dataModel) {
+        // Parsed in place, so every name, value and referent is a view into the mapping
+        pugi::xml_document doc;
+        if (!doc.load_buffer_inplace(data, size)) return;
 
-        std::shared_ptr<Instance> inst = nullptr;
+        auto roblox = doc.child("roblox");
 
-        static const std::set<std::string> serviceClasses = {
-            "Workspace", "Lighting", "RunService", "Selection", "Debris"
+        // Units of work are top-level items plus the children of top-level services,
+        // since nearly everything in a place lives under Workspace. Services are
+        // merged into the live ones here; units are built detached on the workers.
+        struct Unit {
+            pugi::xml_node node;
+            std::shared_ptr<Instance> parent;
+            std::shared_ptr<Instance> root;
+            Referents referents;
         };
+        std::vector<Unit> units;
+        std::vector<pugi::xml_node> services;
+        Referents serviceReferents;
 
-        if (serviceClasses.contains(className)) {
-            inst = FindService(parent, className);
+        for (auto item : roblox.children("Item")) {
+            if (!serviceClasses.contains(item.attribute("class").value())) {
+                units.push_back({ item, dataModel });
+                continue;
+            }
+            auto service = CreateItem(item, dataModel, serviceReferents);
+            if (!service) continue;
+            services.push_back(item);
+            for (auto child : item.children("Item")) {
+                units.push_back({ child, service });
+            }
         }
 
-        if (!inst) {
-            inst = InstanceFactory::Get().Create(className);
-            if (!inst) return;
-        }
+        ParallelFor(units.size(), [&](size_t i) {
+            units[i].root = ProcessItemPass1(units[i].node, nullptr, units[i].referents);
+        });
 
-        if (!refId.empty()) referentMap[refId] = inst;
+        size_t referentCount = serviceReferents.size();
+        for (auto& unit : units) referentCount += unit.referents.size();
+        ReferentTable referents(referentCount);
+        for (auto& [refId, inst] : serviceReferents) referents.Insert(refId, inst);
+        for (auto& unit : units) {
+            for (auto& [refId, inst] : unit.referents) referents.Insert(refId, inst);
+        }
 
-        // Parse properties from XML into PropertyValue map
-        std::map<std::string, PropertyValue> propMap;
-        auto propsNode = node.child("Properties");
+        // Each worker only writes references of instances in its own subtree
+        for (auto service : services) ResolveItemReferences(service, referents);
+        ParallelFor(units.size(), [&](size_t i) {
+            ProcessItemPass2(units[i].node, referents);
+        });
 
-        for (auto prop : propsNode.children()) {
-            std::string type = prop.name();
-            std::string name = prop.attribute("name").value();
+        // Attach in document order; the caller's batch defers registration to the end
+        for (auto& unit : units) {
+            if (unit.root) unit.root->SetParent(unit.parent);
+        }
+    }
 
-            // Normalize names to match Roblox API (PascalCase)
-            if (name == "anchored") name = "Anchored";
-            if (name == "canCollide") name = "CanCollide";
-            if (name == "CoordinateFrame") name = "CFrame";
-            if (name == "size") name = "Size";
-            if (name == "archivable") name = "Archivable";
-            if (name == "name") name = "Name";
-            if (name == "shape") name = "shape"; // PartType uses lowercase in some files
+    void LevelLoader::LoadBinary(const uint8_t* data, size_t size, std::shared_ptr<Instance> dataModel) {
+        // References were resolved by the decoder, so this is a single pass
+        AttachPlace(InstanceSerializer::Deserialize(data, size), dataModel);
+    }
 
-            if (type == "string") {
-                propMap[name] = PropertyValue(std::string(prop.text().get()));
-            }
-            else if (type == "bool") {
-                propMap[name] = PropertyValue(prop.text().as_bool());
-            }
-            else if (type == "float") {
-                propMap[name] = PropertyValue(prop.text().as_float());
-            }
-            else if (type == "token" || type == "int") {
-                propMap[name] = PropertyValue(static_cast<int64_t>(prop.text().as_int()));
+    void LevelLoader::AttachPlace(const std::vector<std::shared_ptr<Instance>>& items, std::shared_ptr<Instance> dataModel) {
+        for (auto& item : items) {
+            std::shared_ptr<Instance> service;
+            if (serviceClasses.contains(item->GetClassName())) {
+                service = FindService(dataModel, item->GetClassName());
             }
-            else if (type == "Vector3") {
-                propMap[name] = PropertyValue(Vector3(
-                    prop.child("X").text().as_float(),
-                    prop.child("Y").text().as_float(),
-                    prop.child("Z").text().as_float()
-                ));
+            if (!service) {
+                item->SetParent(dataModel);
+                continue;
             }
-            else if (type == "CoordinateFrame") {
-                CFrame cf;
-                cf.position = {
-                    prop.child("X").text().as_float(),
-                    prop.child("Y").text().as_float(),
-                    prop.child("Z").text().as_float()
-                };
-                // XML stores rows (R00,R01,R02 is row 0), GLM stores columns
-                // So we need to transpose: column 0 = {R00, R10, R20}
-                cf.rotation[0] = glm::vec3(
-                    prop.child("R00").text().as_float(),
-                    prop.child("R10").text().as_float(),
-                    prop.child("R20").text().as_float()
-                );
-                cf.rotation[1] = glm::vec3(
-                    prop.child("R01").text().as_float(),
-                    prop.child("R11").text().as_float(),
-                    prop.child("R21").text().as_float()
-                );
-                cf.rotation[2] = glm::vec3(
-                    prop.child("R02").text().as_float(),
-                    prop.child("R12").text().as_float(),
-                    prop.child("R22").text().as_float()
-                );
-                propMap[name] = PropertyValue(cf);
-            }
-            else if (type == "Color3") {
-                std::string val = prop.text().get();
-                Color3 col;
-                if (val.find(',') != std::string::npos) {
-                    std::stringstream ss(val);
-                    std::string segment;
-                    float channels[3] = {0,0,0};
-                    for (int i = 0; i < 3 && std::getline(ss, segment, ','); ++i) {
-                        channels[i] = std::stof(segment);
+
+            // Same merge as the XML path: saved properties onto the live service
+            service->SetName(item->GetName());
+            if (auto* desc = item->GetDescriptor(); desc && desc == service->GetDescriptor()) {
+                for (auto& property : desc->flatProperties) {
+                    property.accessor->copy(item.get(), service.get());
+                }
+                for (auto& reference : desc->flatReferences) {
+                    if (auto target = reference.accessor->get(item.get())) {
+                        reference.accessor->set(service.get(), target);
                     }
-                    col = Color3(channels[0], channels[1], channels[2]);
-                } else {
-                    uint32_t packed = std::stoul(val);
-                    col = Color3(
-                        (float)((packed >> 16) & 0xFF) / 255.0f,
-                        (float)((packed >> 8) & 0xFF) / 255.0f,
-                        (float)(packed & 0xFF) / 255.0f
-                    );
                 }
-                propMap[name] = PropertyValue::FromColor3(col);
+            }
+
+            auto children = item->GetChildren();
+            for (auto& child : children) {
+                child->SetParent(service);
             }
         }
+    }
 
-        // Apply properties via ClassDescriptor
-        auto* desc = ClassDescriptor::Get(inst->GetClassName());
-        for (const auto& [name, value] : propMap) {
-            auto* current = desc;
-            while (current) {
-                if (auto it = current->properties.find(name); it != current->properties.end()) {
-                    it->second->set(inst.get(), value);
-                    break;
-                }
-                current = current->baseClass;
+    std::shared_ptr<Instance> LevelLoader::CreateItem(pugi::xml_node node, std::shared_ptr<Instance> parent, Referents& referents) {
+        const char* className = node.attribute("class").value();
+        std::string_view refId = node.attribute("referent").value();
+
+        std::shared_ptr<Instance> inst = nullptr;
+
+        if (serviceClasses.contains(std::string_view(className))) {
+            inst = FindService(parent, className);
+        }
+
+        if (!inst) {
+            inst = InstanceFactory::Get().Create(className);
+            if (!inst) return nullptr;
+        }
+
+        if (!refId.empty()) referents.emplace_back(refId, inst);
+
+        // Properties the class does not have are skipped before their value is decoded
+        auto* desc = inst->GetDescriptor();
+        for (auto prop : node.child("Properties").children()) {
+            std::string_view type = prop.name();
+            std::string_view name = CanonicalPropertyName(prop.attribute("name").value());
+
+            if (name == "Name") {
+                if (type == "string") inst->SetName(prop.text().get());
+                continue;
+            }
+
+            if (auto* accessor = desc ? desc->FindProperty(name) : nullptr) {
+                AssignXmlProperty(prop, type, accessor, inst.get());
             }
         }
 
@@ -264,52 +407,49 @@ namespace Nova {
             inst->SetParent(parent);
         }
 
+        return inst;
+    }
+
+    std::shared_ptr<Instance> LevelLoader::ProcessItemPass1(pugi::xml_node node, std::shared_ptr<Instance> parent, Referents& referents) {
+        auto inst = CreateItem(node, parent, referents);
+        if (!inst) return nullptr;
+
         // Recurse children
         for (auto child : node.children("Item")) {
-            ProcessItemPass1(child, inst);
+            ProcessItemPass1(child, inst, referents);
         }
+        return inst;
     }
 
-    void LevelLoader::ProcessItemPass2(pugi::xml_node node) {
-        std::string refId = std::string(node.attribute("referent").value());
-        auto inst = referentMap[refId];
-        if (!inst) return;
-
-        auto propsNode = node.child("Properties");
-        for (auto prop : propsNode.children("Ref")) {
-            std::string propName = prop.attribute("name").value();
-            std::string targetRef = prop.text().get();
-
-            if (targetRef != "null" && referentMap.contains(targetRef)) {
-                auto target = referentMap[targetRef];
+    void LevelLoader::ProcessItemPass2(pugi::xml_node node, const ReferentTable& referents) {
+        ResolveItemReferences(node, referents);
 
-                if (propName == "PrimaryPart") {
-                    if (auto mod = std::dynamic_pointer_cast<Model>(inst)) {
-                        mod->PrimaryPart = target;
-                    }
-                }
-                else if (propName == "Part0" || propName == "part0") {
-                    if (auto joint = std::dynamic_pointer_cast<JointInstance>(inst)) {
-                        joint->Part0 = std::dynamic_pointer_cast<BasePart>(target);
-                    }
-                }
-                else if (propName == "Part1" || propName == "part1") {
-                    if (auto joint = std::dynamic_pointer_cast<JointInstance>(inst)) {
-                        joint->Part1 = std::dynamic_pointer_cast<BasePart>(target);
-                    }
-                }
-                else if (propName == "CurrentCamera") {
-                    if (auto ws = std::dynamic_pointer_cast<Workspace>(inst)) {
-                        if (auto cam = std::dynamic_pointer_cast<Camera>(target)) {
-                            ws->CurrentCamera = cam;
-                        }
-                    }
-                }
-            }
+        for (auto child : node.children("Item")) {
+            ProcessItemPass2(child, referents);
         }
+    }
 
-        for (auto child : node.children("Item")) {
-            ProcessItemPass2(child);
+    void LevelLoader::ResolveItemReferences(pugi::xml_node node, const ReferentTable& referents) {
+        auto* inst = referents.Find(node.attribute("referent").value());
+        if (!inst) return;
+        auto* desc = (*inst)->GetDescriptor();
+        if (!desc) return;
+
+        for (auto prop : node.child("Properties").children("Ref")) {
+            std::string_view targetRef = prop.text().get();
+            if (targetRef == "null") continue;
+            auto* target = referents.Find(targetRef);
+            if (!target) continue;
+
+            // Older files spell some references in lower camel case (part0)
+            std::string_view propName = prop.attribute("name").value();
+            const IReferenceAccessor* reference = desc->FindReference(propName);
+            if (!reference && !propName.empty()) {
+                std::string upper(propName);
+                upper[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(upper[0])));
+                reference = desc->FindReference(upper);
+            }
+            if (reference) reference->set(inst->get(), *target);
         }
     }
 }
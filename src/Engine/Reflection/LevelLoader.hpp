@@ -9,7 +9,9 @@
 #pragma once
 #include <string>
 #include <memory>
-#include <map>
+#include <string_view>
+#include <utility>
+#include <vector>
 #include <pugixml.hpp>
 #include "Engine/Nova.hpp"
 
@@ -18,23 +20,49 @@ namespace Nova {
     class LevelLoader {
     public:
         /**
-         * @brief Loads a .rbxl file and populates the provided root instance.
-         * @param path The filesystem path to the .rbxl file.
+         * @brief Loads a place file and populates the provided root instance.
+         * The format is picked by the file header: Nova binary places (see
+         * SaveBinary) are decoded directly, checkpoints are restored along with
+         * their physics state, anything else is parsed as .rbxl XML.
+         * @param path The filesystem path to the place file.
          * @param root The root instance (usually the DataModel).
          */
         static void Load(const std::string& path, std::shared_ptr<Instance> root);
 
+        /**
+         * @brief Writes the children of root as a Nova binary place.
+         * @return false if the file could not be written.
+         */
+        static bool SaveBinary(const std::string& path, std::shared_ptr<Instance> root);
+
+        /**
+         * @brief Parents detached top-level items under root. Items of a place
+         * service class (Workspace, Lighting, ...) are merged into the existing service:
+         * their properties, references and children move onto it.
+         */
+        static void AttachPlace(const std::vector<std::shared_ptr<Instance>>& items, std::shared_ptr<Instance> root);
+
         static void PrintInstanceTree(std::shared_ptr<Nova::Instance> instance, int depth = 0);
 
     private:
-        // Pass 1: Hierarchy creation and Referent registration
-        static void ProcessItemPass1(pugi::xml_node node, std::shared_ptr<Instance> parent);
+        static void LoadXml(uint8_t* data, size_t size, std::shared_ptr<Instance> root);
+        static void LoadBinary(const uint8_t* data, size_t size, std::shared_ptr<Instance> root);
 
-        // Pass 2: Reference resolution (Connecting Refs like PrimaryPart)
-        static void ProcessItemPass2(pugi::xml_node node);
+        // Referents registered by one unit of work. The keys point into the parsed document.
+        using Referents = std::vector<std::pair<std::string_view, std::shared_ptr<Instance>>>;
+
+        // Flat referent -> instance table, built between the two passes and read-only in Pass 2
+        struct ReferentTable;
+
+        // Creates (or, for services, finds) the instance for one Item and applies its properties
+        static std::shared_ptr<Instance> CreateItem(pugi::xml_node node, std::shared_ptr<Instance> parent, Referents& referents);
 
-        // Helper to map XML referent IDs to created C++ Instances
-        static inline std::map<std::string, std::shared_ptr<Instance>> referentMap;
+        // Pass 1: Hierarchy creation and Referent registration. Returns the created instance.
+        static std::shared_ptr<Instance> ProcessItemPass1(pugi::xml_node node, std::shared_ptr<Instance> parent, Referents& referents);
+
+        // Pass 2: Reference resolution (Connecting Refs like PrimaryPart)
+        static void ProcessItemPass2(pugi::xml_node node, const ReferentTable& referents);
+        static void ResolveItemReferences(pugi::xml_node node, const ReferentTable& referents);
     };
 
 }
@@ -0,0 +1,85 @@
+// Nova Game Engine
+// Copyright (C) 2026  brambora69123
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+#include "Engine/Reflection/PrototypeCache.hpp"
+#include "Engine/Reflection/LevelLoader.hpp"
+#include "Engine/Objects/InstanceFactory.hpp"
+#include "Engine/Objects/Instance.hpp"
+#include "Common/Log.hpp"
+
+namespace Nova {
+    PrototypeCache& PrototypeCache::Get() {
+        static PrototypeCache cache;
+        return cache;
+    }
+
+    std::shared_ptr<Instance> PrototypeCache::GetTemplate(const std::string& path) {
+        std::error_code ec;
+        auto mtime = std::filesystem::last_write_time(path, ec);
+        if (ec) {
+            LOG_ERR("PrototypeCache", "Cannot stat '%s'", path.c_str());
+            return nullptr;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (auto it = mEntries.find(path); it != mEntries.end() && it->second.mtime == mtime) {
+                return it->second.holder;
+            }
+        }
+
+        // Parsed outside the lock; a racing load of the same file just loses
+        auto holder = InstanceFactory::Get().Create("Model");
+        LevelLoader::Load(path, holder);
+        if (holder->GetChildren().empty()) {
+            LOG_ERR("PrototypeCache", "'%s' has no instances", path.c_str());
+            return nullptr;
+        }
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        mEntries[path] = { mtime, holder };
+        return holder;
+    }
+
+    std::vector<std::shared_ptr<Instance>> PrototypeCache::Instantiate(const std::string& path) {
+        auto holder = GetTemplate(path);
+        if (!holder) return {};
+
+        // Cloning the holder as a whole keeps references between top-level items
+        auto copy = holder->Clone();
+        std::vector<std::shared_ptr<Instance>> items = copy->GetChildren();
+        for (auto it = items.rbegin(); it != items.rend(); ++it) {
+            (*it)->SetParent(nullptr);
+        }
+        return items;
+    }
+
+    std::shared_ptr<Instance> PrototypeCache::InstantiateFirst(const std::string& path) {
+        auto holder = GetTemplate(path);
+        if (!holder) return nullptr;
+        // The whole holder is cloned so references to sibling items land on
+        // copies; cloning the item alone would leave them pointing into the template
+        Instance::CloneMap copies;
+        auto copy = holder->Clone(copies);
+        auto it = copies.find(holder->GetChildren().front().get());
+        if (it == copies.end()) return nullptr;
+        auto first = it->second->shared_from_this();
+        first->SetParent(nullptr);
+        return first;
+    }
+
+    void PrototypeCache::Evict(const std::string& path) {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mEntries.erase(path);
+    }
+
+    void PrototypeCache::Clear() {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mEntries.clear();
+    }
+}
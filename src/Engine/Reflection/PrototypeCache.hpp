@@ -0,0 +1,54 @@
+// Nova Game Engine
+// Copyright (C) 2026  brambora69123
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+#pragma once
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Nova {
+    class Instance;
+
+    // Model files (.rbxm, or anything LevelLoader reads) parsed once into a
+    // template that is never handed out. Every Instantiate is a Clone of that
+    // template, so spawning a character or a projectile costs a tree copy
+    // rather than a file parse. Entries are keyed by path and reloaded when the
+    // file's modification time changes.
+    class PrototypeCache {
+    public:
+        static PrototypeCache& Get();
+
+        // Fresh, detached copies of the file's top-level items, in file order.
+        // References between the items are remapped to the copies. Empty if the
+        // file cannot be loaded.
+        std::vector<std::shared_ptr<Instance>> Instantiate(const std::string& path);
+
+        // First top-level item only, for files holding a single model. References
+        // to the other items point at copies that are not returned, so they expire.
+        std::shared_ptr<Instance> InstantiateFirst(const std::string& path);
+
+        void Evict(const std::string& path);
+        void Clear();
+
+    private:
+        struct Entry {
+            std::filesystem::file_time_type mtime;
+            std::shared_ptr<Instance> holder;  // Top-level items are its children
+        };
+
+        std::mutex mMutex;
+        std::unordered_map<std::string, Entry> mEntries;
+
+        PrototypeCache() = default;
+
+        std::shared_ptr<Instance> GetTemplate(const std::string& path);
+    };
+}
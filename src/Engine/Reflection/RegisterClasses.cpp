@@ -47,7 +47,8 @@ namespace Nova {
 
         // Workspace
         ClassDescriptorBuilder<Workspace>("Workspace", "Instance")
-            .Property("FallenPartsDestroyHeight", &Workspace::FallenPartsDestroyHeight);
+            .Property("FallenPartsDestroyHeight", &Workspace::FallenPartsDestroyHeight)
+            .Reference("CurrentCamera", &Workspace::CurrentCamera);
 
         // DataModel
         ClassDescriptorBuilder<DataModel>("DataModel", "Instance");
@@ -56,7 +57,8 @@ namespace Nova {
         ClassDescriptorBuilder<ScriptContext>("ScriptContext", "Instance");
 
         // Model
-        ClassDescriptorBuilder<Model>("Model", "Instance");
+        ClassDescriptorBuilder<Model>("Model", "Instance")
+            .Reference("PrimaryPart", &Model::PrimaryPart);
 
         // Camera
         ClassDescriptorBuilder<Camera>("Camera", "Instance")
@@ -93,7 +95,9 @@ namespace Nova {
         // Joint types
         ClassDescriptorBuilder<JointInstance>("JointInstance", "Instance")
             .Property("C0", &JointInstance::c0)
-            .Property("C1", &JointInstance::c1);
+            .Property("C1", &JointInstance::c1)
+            .Reference("Part0", &JointInstance::Part0)
+            .Reference("Part1", &JointInstance::Part1);
 
         ClassDescriptorBuilder<AutoJoint>("AutoJoint", "JointInstance");
 
@@ -18,8 +18,49 @@
 #include <LuaBridge/LuaBridge.h>
 
 #include "Common/PropertyValue.hpp"
+#include <string>
+#include <type_traits>
 
 namespace Nova {
+    // Typed stack conversion shared by the property thunks and method bindings.
+    // Scalars and strings use the raw API; everything else goes through LuaBridge.
+    template<typename V>
+    void pushLuaValue(lua_State* L, const V& v) {
+        if constexpr (std::is_same_v<V, bool>) lua_pushboolean(L, v);
+        else if constexpr (std::is_arithmetic_v<V> || std::is_enum_v<V>) lua_pushnumber(L, static_cast<double>(v));
+        else if constexpr (std::is_same_v<V, std::string>) lua_pushlstring(L, v.data(), v.size());
+        else if (!luabridge::push(L, v)) lua_pushnil(L);
+    }
+
+    // Leaves out untouched and returns false on a type mismatch
+    template<typename V>
+    bool readLuaValue(lua_State* L, int idx, V& out) {
+        if constexpr (std::is_same_v<V, bool>) {
+            if (lua_type(L, idx) != LUA_TBOOLEAN) return false;
+            out = lua_toboolean(L, idx) != 0;
+        }
+        else if constexpr (std::is_enum_v<V>) {
+            if (lua_type(L, idx) != LUA_TNUMBER) return false;
+            out = static_cast<V>(static_cast<int64_t>(lua_tonumber(L, idx)));
+        }
+        else if constexpr (std::is_arithmetic_v<V>) {
+            if (lua_type(L, idx) != LUA_TNUMBER) return false;
+            out = static_cast<V>(lua_tonumber(L, idx));
+        }
+        else if constexpr (std::is_same_v<V, std::string>) {
+            if (lua_type(L, idx) != LUA_TSTRING) return false;
+            size_t len = 0;
+            const char* str = lua_tolstring(L, idx, &len);
+            out.assign(str, len);
+        }
+        else {
+            auto result = luabridge::Stack<V>::get(L, idx);
+            if (!result) return false;
+            out = std::move(*result);
+        }
+        return true;
+    }
+
     inline luabridge::LuaRef propertyValueToLua(lua_State* L, const PropertyValue& v) {
         switch (v.kind) {
             case PropertyValue::Kind::Nil:
@@ -35,9 +76,7 @@ namespace Nova {
             case PropertyValue::Kind::Vector3:
                 return luabridge::LuaRef(L, v.toVector3());
             case PropertyValue::Kind::CFrame:
-                // CFrame isn't directly pushable via LuaBridge yet,
-                // so we store it as a special userdata or just return nil for now
-                return luabridge::LuaRef(L);
+                return luabridge::LuaRef(L, v.toCFrame());
             case PropertyValue::Kind::Color3:
                 return luabridge::LuaRef(L, v.toColor3());
         }
@@ -56,8 +95,8 @@ namespace Nova {
                 auto res = v.cast<Vector3>();
                 lua_pop(L, 1);
                 if (res) return PropertyValue(res.value());
-            } else if (luabridge::Stack<Color3>::isInstance(L, -1)) {
-                auto res = v.cast<Color3>();
+            } else if (luabridge::Stack<CFrame>::isInstance(L, -1)) {
+                auto res = v.cast<CFrame>();
                 lua_pop(L, 1);
                 if (res) return PropertyValue(res.value());
             } else {
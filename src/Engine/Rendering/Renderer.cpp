@@ -108,23 +108,23 @@ namespace Nova {
             cameraPos = workspace->CurrentCamera->cframe.position;
         }
 
-        for (auto& physical : workspace->cachedParts) {
-            glm::mat4 worldMatrix = physical->GetLocalTransform();
-            glm::vec3 size = physical->GetSize();
-            glm::vec3 worldPos = glm::vec3(worldMatrix[3]);
+        // Streams the Workspace PartStore arrays rather than chasing part pointers
+        const PartStore& store = workspace->partStore;
+        for (size_t i = 0; i < store.Size(); i++) {
+            const CFrame& cframe = store.cframes[i];
+            const glm::vec3& size = store.sizes[i];
             float radius = glm::length(size) * 0.5f;
 
-            if (frustum.IntersectsSphere(worldPos, radius)) {
-                glm::mat4 scaledMatrix = glm::scale(worldMatrix, size);
+            if (frustum.IntersectsSphere(cframe.position, radius)) {
+                glm::mat4 scaledMatrix = glm::scale(cframe.to_mat4(), size);
+                const PartSurfaces& s = store.surfaces[i];
                 InstanceData data = {
                     viewProj * scaledMatrix,
                     scaledMatrix,
-                    physical->GetColor(),
+                    store.colors[i],
                     glm::vec4(size, 1.0f),
                     {
-                        (int32_t)physical->frontSurface, (int32_t)physical->backSurface,
-                        (int32_t)physical->leftSurface, (int32_t)physical->rightSurface,
-                        (int32_t)physical->topSurface, (int32_t)physical->bottomSurface,
+                        s[0], s[1], s[2], s[3], s[4], s[5],
                         0, 0 // Padding
                     }
                 };
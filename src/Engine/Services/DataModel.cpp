@@ -8,11 +8,22 @@
 
 #include "Engine/Services/DataModel.hpp"
 #include "Engine/Objects/InstanceFactory.hpp"
+#include "Engine/Objects/BasePart.hpp"
+#include "Engine/Objects/JointInstance.hpp"
+#include "Engine/Objects/Script.hpp"
+#include "Engine/Services/PhysicsService.hpp"
+#include "Engine/Services/NetworkService.hpp"
+#include <unordered_set>
 
 namespace Nova {
     std::shared_ptr<Instance> DataModel::GetService(const std::string& className) {
-        for (auto& child : children) {
-            if (child->GetClassName() == className) return child;
+        ServiceID id = ServiceIDFromClassName(className);
+        if (id != ServiceID::Count) {
+            if (auto& service = mServices[static_cast<size_t>(id)]) return service;
+        } else {
+            for (auto& child : children) {
+                if (child->GetClassName() == className) return child;
+            }
         }
 
         auto s = InstanceFactory::Get().Create(className);
@@ -21,4 +32,82 @@ namespace Nova {
         }
         return s;
     }
+
+    void DataModel::OnChildAdded(const std::shared_ptr<Instance>& child) {
+        ServiceID id = ServiceIDFromClassName(child->GetClassName());
+        if (id == ServiceID::Count) return;
+        auto& slot = mServices[static_cast<size_t>(id)];
+        if (!slot) slot = child;
+    }
+
+    void DataModel::OnChildRemoved(Instance* child) {
+        for (auto& slot : mServices) {
+            if (slot.get() == child) slot.reset();
+        }
+    }
+
+    void DataModel::EndBatch() {
+        if (--mBatchDepth == 0) FlushBatch();
+    }
+
+    void DataModel::FlushBatch() {
+        // Flushing runs scripts and may reparent again, which opens a fresh batch
+        Batch batch = std::move(mBatch);
+        mBatch = {};
+
+        // Entries are filtered against the final tree state, so a part moved
+        // out and back in within one batch costs nothing.
+        if (!batch.unregisterParts.empty()) {
+            std::unordered_map<PhysicsService*, std::vector<BasePart*>> byService;
+            std::vector<std::shared_ptr<PhysicsService>> services;
+            for (auto& part : batch.unregisterParts) {
+                if (part->IsInWorkspace() || !part->IsPhysicsRegistered()) continue;
+                auto physics = part->registeredService.lock();
+                if (!physics) continue;
+                auto& list = byService[physics.get()];
+                if (list.empty()) services.push_back(physics);
+                list.push_back(part.get());
+            }
+            for (auto& physics : services) {
+                physics->BulkUnregisterParts(byService[physics.get()]);
+            }
+        }
+
+        if (!batch.registerParts.empty()) {
+            std::unordered_set<BasePart*> seen;
+            std::vector<std::shared_ptr<BasePart>> parts;
+            parts.reserve(batch.registerParts.size());
+            for (auto& part : batch.registerParts) {
+                if (part->GetDataModel() != this || !part->IsInWorkspace()) continue;
+                if (part->IsPhysicsRegistered() || !seen.insert(part.get()).second) continue;
+                parts.push_back(std::move(part));
+            }
+            if (!parts.empty()) GetService<PhysicsService>()->BulkRegisterParts(parts);
+        }
+
+        if (!batch.constraints.empty()) {
+            std::unordered_set<JointInstance*> seen;
+            std::vector<std::shared_ptr<JointInstance>> joints;
+            for (auto& joint : batch.constraints) {
+                if (joint->GetDataModel() != this || !joint->IsInWorkspace()) continue;
+                if (!seen.insert(joint.get()).second) continue;
+                joints.push_back(std::move(joint));
+            }
+            if (!joints.empty()) GetService<PhysicsService>()->RegisterConstraints(joints);
+        }
+
+        if (!batch.replicationRoots.empty()) {
+            if (auto* network = FindService<NetworkService>()) {
+                std::erase_if(batch.replicationRoots, [this](const std::shared_ptr<Instance>& root) {
+                    return root->GetDataModel() != this || !root->IsInWorkspace() || root->IsDestroyed();
+                });
+                network->ReplicateNewInstances(batch.replicationRoots);
+            }
+        }
+
+        for (auto& script : batch.scripts) {
+            if (script->Disabled || script->GetDataModel() != this || !script->IsInWorkspace()) continue;
+            script->Run();
+        }
+    }
 }
@@ -8,24 +8,83 @@
 
 #pragma once
 #include "Engine/Objects/Instance.hpp"
+#include "Engine/Services/ServiceID.hpp"
+#include <array>
 
 namespace Nova {
+    class BasePart;
+    class JointInstance;
+    class Script;
+
     class DataModel : public Instance {
     public:
-        DataModel() : Instance("Game") {}
+        DataModel() : Instance("Game") { m_dataModel = this; }
+        ~DataModel() override { DetachDescendantsFromDataModel(); }
+
         std::string GetClassName() const override { return "DataModel"; }
-        std::string GetName() const override { return m_debugName; }
+        const std::string& GetName() const override { return m_debugName; }
 
         template<typename T>
         std::shared_ptr<T> GetService() {
-            for (auto& child : children) {
-                if (auto service = std::dynamic_pointer_cast<T>(child)) return service;
+            if (auto& service = mServices[static_cast<size_t>(T::StaticServiceID)]) {
+                return std::static_pointer_cast<T>(service);
             }
             auto s = std::make_shared<T>();
             s->SetParent(shared_from_this());
             return s;
         }
 
+        // Lookup only; never creates the service
+        template<typename T>
+        T* FindService() const {
+            return static_cast<T*>(mServices[static_cast<size_t>(T::StaticServiceID)].get());
+        }
+
         std::shared_ptr<Instance> GetService(const std::string& className);
+
+        // Tree mutation batching. While a batch is open, ancestry side effects
+        // (physics registration, constraints, script runs, replication) are
+        // queued and flushed in bulk when the outermost batch ends.
+        void BeginBatch() { mBatchDepth++; }
+        void EndBatch();
+        bool IsBatching() const { return mBatchDepth > 0; }
+
+        class BatchScope {
+        public:
+            explicit BatchScope(DataModel* dm) : mDataModel(dm) { if (mDataModel) mDataModel->BeginBatch(); }
+            ~BatchScope() { if (mDataModel) mDataModel->EndBatch(); }
+
+            BatchScope(const BatchScope&) = delete;
+            BatchScope& operator=(const BatchScope&) = delete;
+
+        private:
+            DataModel* mDataModel;
+        };
+
+        void QueuePartRegister(std::shared_ptr<BasePart> part) { mBatch.registerParts.push_back(std::move(part)); }
+        void QueuePartUnregister(std::shared_ptr<BasePart> part) { mBatch.unregisterParts.push_back(std::move(part)); }
+        void QueueConstraint(std::shared_ptr<JointInstance> joint) { mBatch.constraints.push_back(std::move(joint)); }
+        void QueueScriptRun(std::shared_ptr<Script> script) { mBatch.scripts.push_back(std::move(script)); }
+        void QueueReplication(std::shared_ptr<Instance> root) { mBatch.replicationRoots.push_back(std::move(root)); }
+
+    protected:
+        void OnChildAdded(const std::shared_ptr<Instance>& child) override;
+        void OnChildRemoved(Instance* child) override;
+
+    private:
+        // Filled as services are parented here, indexed by ServiceID
+        std::array<std::shared_ptr<Instance>, ServiceCount> mServices;
+
+        struct Batch {
+            std::vector<std::shared_ptr<BasePart>> registerParts;
+            std::vector<std::shared_ptr<BasePart>> unregisterParts;
+            std::vector<std::shared_ptr<JointInstance>> constraints;
+            std::vector<std::shared_ptr<Script>> scripts;
+            std::vector<std::shared_ptr<Instance>> replicationRoots;
+        };
+        int mBatchDepth = 0;
+        Batch mBatch;
+
+        void FlushBatch();
     };
 }
@@ -9,6 +9,7 @@
 #pragma once
 #include "Common/MathTypes.hpp"
 #include "Engine/Objects/Instance.hpp"
+#include "Engine/Services/ServiceID.hpp"
 
 namespace Nova {
     class Lighting : public Instance {
@@ -21,7 +22,10 @@ namespace Nova {
         std::string TimeOfDay = "14:00:00";
 
         Lighting() : Instance("Lighting") {}
+
+        static constexpr ServiceID StaticServiceID = ServiceID::Lighting;
+
         std::string GetClassName() const override { return "Lighting"; }
-        std::string GetName() const override { return m_debugName; }
+        const std::string& GetName() const override { return m_debugName; }
     };
 }
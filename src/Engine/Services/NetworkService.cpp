@@ -276,7 +276,7 @@ namespace Nova {
                     if (sync.isSyncing) syncingCount++;
                 }
                 LOG_INF("Network", "Diag: outQueue=%zu pending=%zu dropped=%zu syncing=%zu lastSent=%zu markDirty=%zu",
-                    queueSize, mPendingProperties.size(), dropped, syncingCount,
+                    queueSize, mDirtyInstances.size(), dropped, syncingCount,
                     mLastSentCFrame.size(), mMarkDirtyCalls.exchange(0));
             }
         }
@@ -312,7 +312,9 @@ namespace Nova {
 
         static constexpr size_t MAX_PACKETS_PER_FRAME = 200;
         size_t processed = 0;
-        bool needsRefresh = false;
+
+        // A frame's worth of CreateObject packets registers its parts in one go
+        DataModel::BatchScope batch(GetDataModel());
 
         while (!packets.empty() && processed < MAX_PACKETS_PER_FRAME) {
             auto& pkt = packets.front();
@@ -328,11 +330,9 @@ namespace Nova {
                 switch (type) {
                     case PacketType::CreateObject:
                         HandleCreateObject(pkt.sender, reader);
-                        needsRefresh = true;
                         break;
                     case PacketType::DestroyObject:
                         HandleDestroyObject(pkt.sender, reader);
-                        needsRefresh = true;
                         break;
                     case PacketType::PropertyUpdate:
                         HandlePropertyUpdate(pkt.sender, reader);
@@ -381,14 +381,6 @@ namespace Nova {
                 packets.pop();
             }
         }
-
-        if (needsRefresh) {
-            if (auto dm = GetDataModel()) {
-                if (auto ws = dm->GetService<Workspace>()) {
-                    ws->RefreshCachedParts();
-                }
-            }
-        }
     }
 
     void NetworkService::ProcessSyncQueue() {
@@ -424,15 +416,14 @@ namespace Nova {
                         sentCreates.insert(change.targetID);
                     }
 
-                    auto* desc = ClassDescriptor::Get(instance->GetClassName());
+                    auto* desc = instance->GetDescriptor();
                     if (!desc) continue;
 
-                    auto* accessor = desc->FindProperty(change.propertyName);
-                    if (!accessor) continue;
-
-                    PropertyValue value = accessor->get(instance);
-                    SendPropertyUpdate(sync.peer, change.targetID, change.propertyName, value);
-                    flushed++;
+                    ForEachDirtyProperty(desc, change.mask, [&](PropertyID id) {
+                        PropertyValue value = desc->GetProperty(id)->get(instance);
+                        SendPropertyUpdate(sync.peer, change.targetID, desc->GetPropertyName(id), value);
+                        flushed++;
+                    });
                 }
 
                 LOG_INF("Network", "FullSync complete (%zu queued changes flushed)", flushed);
@@ -450,14 +441,14 @@ namespace Nova {
             return;
         }
 
-        auto player = std::make_shared<Player>("Player_" + std::to_string(peer->connectID),
+        auto player = MakePooled<Player>("Player_" + std::to_string(peer->connectID),
                                                 peer->connectID);
         mPlayers.push_back(player);
         mPeerToPlayer[peer] = player;
 
         auto dm = GetDataModel();
         if (dm) {
-            player->SetParent(dm);
+            player->SetParent(dm->shared_from_this());
         }
 
         LOG_INF("Network", "Player connected: %s (ID: %u)", player->GetName().c_str(), peer->connectID);
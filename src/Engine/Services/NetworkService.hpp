@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Engine/Objects/Instance.hpp"
+#include "Engine/Services/ServiceID.hpp"
 #include "Engine/Networking/NetworkID.hpp"
 #include "Engine/Networking/ReplicationProtocol.hpp"
 #include "Common/PropertyValue.hpp"
@@ -22,6 +23,7 @@
 #include <mutex>
 #include <thread>
 #include <atomic>
+#include <bit>
 #include <string>
 
 namespace Nova {
@@ -34,8 +36,10 @@ namespace Nova {
         NetworkService();
         ~NetworkService();
 
+        static constexpr ServiceID StaticServiceID = ServiceID::NetworkService;
+
         std::string GetClassName() const override { return "NetworkService"; }
-        std::string GetName() const override { return m_debugName; }
+        const std::string& GetName() const override { return m_debugName; }
 
         // Server mode
         bool StartServer(uint16_t port);
@@ -59,12 +63,21 @@ namespace Nova {
         // NetworkID registry
         NetworkIDRegistry& GetIDRegistry() { return mIDRegistry; }
 
-        // Mark a property as dirty for replication
-        void MarkDirty(Instance* inst, const std::string& prop);
+        // Mark a property as dirty for replication. Sets the property's bit in
+        // inst->dirtyMask; the first mark since the last drain lists the instance.
+        void MarkDirty(Instance* inst, PropertyID id);
 
         // Broadcast destroy to all clients
         void BroadcastDestroyObject(NetworkID id);
 
+        // Destroyed subtree in pre-order, still linked. The server sends one destroy
+        // per replicated root and clients expand it locally; clients drop the IDs.
+        void OnSubtreeDestroyed(const std::vector<std::shared_ptr<Instance>>& subtree);
+
+        // Server: assign IDs to instances new under these workspace subtrees
+        // and send them to every client in one burst
+        void ReplicateNewInstances(const std::vector<std::shared_ptr<Instance>>& roots);
+
     private:
         ENetHost* mHost = nullptr;
         bool mIsServer = false;
@@ -79,11 +92,10 @@ namespace Nova {
         std::unordered_map<ENetPeer*, std::shared_ptr<Player>> mPeerToPlayer;
         NetworkIDRegistry mIDRegistry;
 
-        // Dirty property tracking
-        struct DirtyProperty {
+        // Dirty properties of one instance, held back while a peer is in FullSync
+        struct QueuedChange {
             NetworkID targetID;
-            std::string propertyName;
-            std::shared_ptr<Instance> instance;  // Keep instance alive
+            uint64_t mask;
         };
 
         // Incremental sync queue (server side)
@@ -92,7 +104,7 @@ namespace Nova {
             std::vector<std::weak_ptr<Instance>> objects;
             size_t nextIndex = 0;
             bool isSyncing = false;  // True while FullSync is in progress
-            std::vector<DirtyProperty> queuedChanges;  // Changes during sync
+            std::vector<QueuedChange> queuedChanges;  // Changes during sync
             std::unordered_set<NetworkID> syncedIDs;  // IDs already sent in FullSync
         };
         std::vector<PendingSync> mPendingSyncs;
@@ -121,12 +133,30 @@ namespace Nova {
         static constexpr size_t MAX_OUTGOING_QUEUE = 4096;
         std::atomic<size_t> mDroppedPackets{0};
 
-        // Pending property updates (deduplicated by instance+property, only main thread)
-        std::unordered_map<uint64_t, DirtyProperty> mPendingProperties;
+        // Instances with a non-zero dirtyMask, each listed once (only main thread).
+        // Holding them keeps the instance alive until the next drain.
+        std::vector<std::shared_ptr<Instance>> mDirtyInstances;
 
         // CFrame drift detection: track last replicated CFrame per object
         std::unordered_map<NetworkID, CFrame> mLastSentCFrame;
 
+        // Calls fn(id) for each property set in an instance's dirty mask. The shared
+        // top bit expands to every replicated property from ID 63 on.
+        template<typename Fn>
+        static void ForEachDirtyProperty(const ClassDescriptor* desc, uint64_t mask, Fn&& fn) {
+            uint64_t low = mask & ~Instance::PropertyBit(63);
+            while (low) {
+                auto id = static_cast<PropertyID>(std::countr_zero(low));
+                low &= low - 1;
+                if (id < desc->flatProperties.size()) fn(id);
+            }
+            if (mask & Instance::PropertyBit(63)) {
+                for (PropertyID id : desc->replicatedIDs) {
+                    if (id >= 63) fn(id);
+                }
+            }
+        }
+
         // Send rate control
         float mSendTimer = 0.0f;
         static constexpr float SEND_RATE = 1.0f / 60.0f;  // 60 Hz
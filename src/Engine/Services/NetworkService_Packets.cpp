@@ -29,7 +29,7 @@ namespace Nova {
         }
 
         instance->networkID = networkID;
-        instance->m_debugName = name;
+        instance->SetName(name);
 
         if (parentNetworkID != 0) {
             auto parentIt = mClientInstances.find(parentNetworkID);
@@ -71,14 +71,10 @@ namespace Nova {
 
         auto it = mClientInstances.find(networkID);
         if (it != mClientInstances.end()) {
-            it->second->Destroy();
-            mClientInstances.erase(it);
-
-            if (auto dm = GetDataModel()) {
-                if (auto ws = dm->GetService<Workspace>()) {
-                    ws->RefreshCachedParts();
-                }
-            }
+            // Destroy expands to the whole subtree and drops every ID under it
+            auto instance = it->second;
+            instance->Destroy();
+            mClientInstances.erase(networkID);
         }
     }
 
@@ -96,7 +92,7 @@ namespace Nova {
             return;
         }
 
-        auto* desc = ClassDescriptor::Get(instance->GetClassName());
+        auto* desc = instance->GetDescriptor();
         if (!desc) return;
 
         auto* accessor = desc->FindProperty(propertyName);
@@ -107,7 +103,10 @@ namespace Nova {
                     return;
                 }
             }
-            accessor->set(instance.get(), value);
+            if (accessor->set(instance.get(), value)) {
+                if (auto* bp = dynamic_cast<BasePart*>(instance.get())) bp->SyncHotState();
+                instance->NotifyPropertyChanged(propertyName);
+            }
         }
     }
 
@@ -131,7 +130,7 @@ namespace Nova {
             return;
         }
 
-        auto* desc = ClassDescriptor::Get(instance->GetClassName());
+        auto* desc = instance->GetDescriptor();
         if (!desc) return;
 
         for (uint16_t i = 0; i < count; i++) {
@@ -144,10 +143,12 @@ namespace Nova {
                 }
             }
             auto* accessor = desc->FindProperty(propertyName);
-            if (accessor) {
-                accessor->set(instance.get(), value);
+            if (accessor && accessor->set(instance.get(), value)) {
+                instance->NotifyPropertyChanged(propertyName);
             }
         }
+
+        if (auto* bp = dynamic_cast<BasePart*>(instance.get())) bp->SyncHotState();
     }
 
     void NetworkService::HandleRemoteEvent(ENetPeer* sender, PacketReader& reader) {
@@ -15,6 +15,8 @@
 #include "Common/Log.hpp"
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
+#include <algorithm>
+#include <optional>
 
 namespace Nova {
 
@@ -24,6 +26,7 @@ namespace Nova {
         if (root->networkID == 0) {
             root->networkID = mIDRegistry.Allocate();
             mIDRegistry.Register(root, root->networkID);
+            if (auto* part = dynamic_cast<BasePart*>(root)) part->SyncHotState();
         }
 
         for (auto& child : root->GetChildren()) {
@@ -35,7 +38,7 @@ namespace Nova {
         auto dm = GetDataModel();
         if (!dm) return;
 
-        AssignNetworkIDs(dm.get());
+        AssignNetworkIDs(dm);
 
         auto workspace = dm->GetService<Workspace>();
         if (!workspace) return;
@@ -67,19 +70,14 @@ namespace Nova {
     }
 
     void NetworkService::SendReplicatedProperties(ENetPeer* peer, Instance* instance, NetworkID id) {
-        auto* desc = ClassDescriptor::Get(instance->GetClassName());
+        auto* desc = instance->GetDescriptor();
         if (!desc) return;
 
         std::vector<std::pair<std::string, PropertyValue>> properties;
-        const ClassDescriptor* current = desc;
-        while (current) {
-            for (auto& name : current->replicatedProperties) {
-                auto it = current->properties.find(name);
-                if (it == current->properties.end()) continue;
-                PropertyValue value = it->second->get(instance);
-                properties.emplace_back(name, value);
-            }
-            current = current->baseClass;
+        properties.reserve(desc->replicatedIDs.size());
+        for (PropertyID id : desc->replicatedIDs) {
+            auto& property = desc->flatProperties[id];
+            properties.emplace_back(property.name, property.accessor->get(instance));
         }
 
         if (!properties.empty()) {
@@ -113,20 +111,17 @@ namespace Nova {
         if (!instance || instance->networkID == 0) return;
 
         std::vector<std::pair<std::string, PropertyValue>> properties;
-        auto* desc = ClassDescriptor::Get(instance->GetClassName());
+        auto* desc = instance->GetDescriptor();
         if (desc) {
-            const ClassDescriptor* current = desc;
-            while (current) {
-                for (auto& name : current->replicatedProperties) {
-                    auto it = current->properties.find(name);
-                    if (it == current->properties.end()) continue;
-                    PropertyValue value = it->second->get(instance);
-                    properties.emplace_back(name, value);
-                    if (name == "CFrame" && value.isCFrame()) {
-                        mLastSentCFrame[instance->networkID] = value.toCFrame();
-                    }
+            PropertyID cframeID = desc->FindPropertyID("CFrame");
+            properties.reserve(desc->replicatedIDs.size());
+            for (PropertyID id : desc->replicatedIDs) {
+                auto& property = desc->flatProperties[id];
+                PropertyValue value = property.accessor->get(instance);
+                if (id == cframeID && value.isCFrame()) {
+                    mLastSentCFrame[instance->networkID] = value.toCFrame();
                 }
-                current = current->baseClass;
+                properties.emplace_back(property.name, std::move(value));
             }
         }
 
@@ -205,25 +200,23 @@ namespace Nova {
         QueueSend(peer, writer, PacketType::BulkCFrameUpdate, false);
     }
 
-    void NetworkService::MarkDirty(Instance* inst, const std::string& prop) {
-        if (!mIsServer || inst->networkID == 0) return;
+    void NetworkService::MarkDirty(Instance* inst, PropertyID id) {
+        if (!mIsServer || inst->networkID == 0 || id == InvalidPropertyID) return;
 
         mMarkDirtyCalls.fetch_add(1, std::memory_order_relaxed);
 
-        uint64_t key = (uint64_t(inst->networkID) << 32) | std::hash<std::string>{}(prop);
-        mPendingProperties[key] = {inst->networkID, prop, inst->shared_from_this()};
+        if (inst->dirtyMask == 0) mDirtyInstances.push_back(inst->shared_from_this());
+        inst->dirtyMask |= Instance::PropertyBit(id);
     }
 
     void NetworkService::BroadcastDestroyObject(NetworkID id) {
         if (!mIsServer) return;
 
-        for (auto it = mPendingProperties.begin(); it != mPendingProperties.end();) {
-            if (it->second.targetID == id) {
-                it = mPendingProperties.erase(it);
-            } else {
-                ++it;
-            }
-        }
+        std::erase_if(mDirtyInstances, [id](const auto& inst) {
+            if (inst->networkID != id) return false;
+            inst->dirtyMask = 0;
+            return true;
+        });
 
         mLastSentCFrame.erase(id);
 
@@ -234,24 +227,103 @@ namespace Nova {
         mIDRegistry.Unregister(id);
     }
 
+    void NetworkService::OnSubtreeDestroyed(const std::vector<std::shared_ptr<Instance>>& subtree) {
+        if (mIsClient) {
+            for (auto& inst : subtree) {
+                if (inst->networkID != 0) mClientInstances.erase(inst->networkID);
+            }
+            return;
+        }
+        if (!mIsServer) return;
+
+        // A replicated node under a replicated parent is removed with it on the client
+        std::unordered_set<NetworkID> ids;
+        std::unordered_set<const Instance*> covered;
+        std::vector<NetworkID> roots;
+        for (auto& inst : subtree) {
+            if (inst->networkID == 0) continue;
+            auto parent = inst->GetParent();
+            if (!parent || !covered.contains(parent.get())) roots.push_back(inst->networkID);
+            covered.insert(inst.get());
+            ids.insert(inst->networkID);
+        }
+        if (ids.empty()) return;
+
+        std::erase_if(mDirtyInstances, [&ids](const auto& inst) {
+            if (!ids.contains(inst->networkID)) return false;
+            inst->dirtyMask = 0;
+            return true;
+        });
+        for (NetworkID id : ids) {
+            mLastSentCFrame.erase(id);
+            mIDRegistry.Unregister(id);
+        }
+
+        for (auto& [peer, player] : mPeerToPlayer) {
+            for (NetworkID id : roots) {
+                SendDestroyObject(peer, id);
+            }
+        }
+    }
+
+    void NetworkService::ReplicateNewInstances(const std::vector<std::shared_ptr<Instance>>& roots) {
+        if (!mIsServer) return;
+
+        // Instances that already have an ID are known to clients
+        std::vector<std::shared_ptr<Instance>> created;
+        auto assign = [&](const std::shared_ptr<Instance>& inst) {
+            if (inst->networkID != 0) return;
+            inst->networkID = mIDRegistry.Allocate();
+            mIDRegistry.Register(inst.get(), inst->networkID);
+            if (inst->IsA<BasePart>()) static_cast<BasePart*>(inst.get())->SyncHotState();
+            created.push_back(inst);
+        };
+        for (auto& root : roots) {
+            assign(root);
+            root->ForEachDescendant(assign);
+        }
+        if (created.empty()) return;
+
+        for (auto& [peer, player] : mPeerToPlayer) {
+            PendingSync* syncing = nullptr;
+            for (auto& sync : mPendingSyncs) {
+                if (sync.peer == peer && sync.isSyncing) {
+                    syncing = &sync;
+                    break;
+                }
+            }
+
+            // Peers still in FullSync get them appended to their sync queue
+            if (syncing) {
+                syncing->objects.insert(syncing->objects.end(), created.begin(), created.end());
+                continue;
+            }
+            for (auto& inst : created) {
+                SendCreateObject(peer, inst.get());
+            }
+        }
+    }
+
     void NetworkService::CheckForDrift() {
         auto dm = GetDataModel();
         if (!dm) return;
         auto ws = dm->GetService<Workspace>();
         if (!ws) return;
 
-        auto* desc = ClassDescriptor::Get("BasePart");
+        auto* desc = ClassDescriptor::Of<BasePart>();
         if (!desc) return;
-        auto* cframeAccessor = desc->FindProperty("CFrame");
-        if (!cframeAccessor) return;
+        PropertyID cframeID = desc->FindPropertyID("CFrame");
+        if (cframeID == InvalidPropertyID) return;
 
-        for (auto& part : ws->cachedParts) {
-            if (part->networkID == 0) continue;
+        const PartStore& store = ws->partStore;
+        for (size_t i = 0; i < store.Size(); i++) {
+            NetworkID id = store.networkIDs[i];
+            if (id == 0) continue;
 
-            auto it = mLastSentCFrame.find(part->networkID);
+            auto it = mLastSentCFrame.find(id);
             if (it == mLastSentCFrame.end()) continue;
 
-            const CFrame& currentCF = part->cframe;
+            const CFrame& currentCF = store.cframes[i];
             const CFrame& lastSent = it->second;
 
             float posDist = glm::distance(currentCF.position, lastSent.position);
@@ -260,66 +332,59 @@ namespace Nova {
                 glm::quat_cast(lastSent.rotation)));
 
             if (posDist > 0.05f || rotDot < 0.999f) {
-                MarkDirty(part.get(), "CFrame");
+                MarkDirty(ws->cachedParts[i].get(), cframeID);
             }
         }
     }
 
     void NetworkService::DrainPendingProperties() {
         if (!mIsServer) return;
-        if (mPendingProperties.empty()) return;
+        if (mDirtyInstances.empty()) return;
 
-        std::unordered_map<uint64_t, DirtyProperty> pending;
-        pending.swap(mPendingProperties);
+        std::vector<std::shared_ptr<Instance>> dirty;
+        dirty.swap(mDirtyInstances);
 
-        std::unordered_set<ENetPeer*> syncingPeers;
+        std::vector<PendingSync*> syncing;
         for (auto& sync : mPendingSyncs) {
-            if (sync.isSyncing) {
-                syncingPeers.insert(sync.peer);
-            }
+            if (sync.isSyncing) syncing.push_back(&sync);
         }
-
-        // Separate CFrame updates (bulk) from other properties (per-part batch)
-        struct BatchKey {
-            ENetPeer* peer;
-            NetworkID targetID;
-            bool operator==(const BatchKey& o) const { return peer == o.peer && targetID == o.targetID; }
-        };
-        struct BatchKeyHash {
-            size_t operator()(const BatchKey& k) const {
-                return std::hash<ENetPeer*>{}(k.peer) ^ (std::hash<NetworkID>{}(k.targetID) << 16);
-            }
+        auto isSyncing = [&syncing](ENetPeer* peer) {
+            return std::any_of(syncing.begin(), syncing.end(), [peer](PendingSync* s) { return s->peer == peer; });
         };
-        std::unordered_map<ENetPeer*, std::vector<std::pair<NetworkID, CFrame>>> cframeBatches;
-        std::unordered_map<BatchKey, std::vector<std::pair<std::string, PropertyValue>>, BatchKeyHash> otherBatches;
 
-        for (auto& [key, prop] : pending) {
-            auto instance = prop.instance;
-            if (!instance || instance->IsDestroyed()) continue;
+        // CFrames go out in one bulk packet per peer, everything else batched per instance
+        std::unordered_map<ENetPeer*, std::vector<std::pair<NetworkID, CFrame>>> cframeBatches;
+        std::vector<std::pair<std::string, PropertyValue>> properties;
 
-            auto* desc = ClassDescriptor::Get(instance->GetClassName());
-            if (!desc) continue;
+        for (auto& instance : dirty) {
+            uint64_t mask = instance->dirtyMask;
+            instance->dirtyMask = 0;
+            if (mask == 0 || instance->IsDestroyed()) continue;
 
-            auto* accessor = desc->FindProperty(prop.propertyName);
-            if (!accessor) continue;
+            auto* desc = instance->GetDescriptor();
+            NetworkID targetID = instance->networkID;
+            if (!desc || targetID == 0) continue;
 
-            PropertyValue value = accessor->get(instance.get());
+            for (PendingSync* sync : syncing) {
+                sync->queuedChanges.push_back({targetID, mask});
+            }
 
-            for (auto& [peer, player] : mPeerToPlayer) {
-                if (syncingPeers.contains(peer)) {
-                    for (auto& sync : mPendingSyncs) {
-                        if (sync.peer == peer && sync.isSyncing) {
-                            sync.queuedChanges.push_back(prop);
-                            break;
-                        }
-                    }
+            std::optional<CFrame> cframe;
+            properties.clear();
+            ForEachDirtyProperty(desc, mask, [&](PropertyID id) {
+                const std::string& name = desc->GetPropertyName(id);
+                PropertyValue value = desc->GetProperty(id)->get(instance.get());
+                if (value.isCFrame() && name == "CFrame") {
+                    cframe = value.toCFrame();
                 } else {
-                    if (prop.propertyName == "CFrame" && value.isCFrame()) {
-                        cframeBatches[peer].emplace_back(prop.targetID, value.toCFrame());
-                    } else {
-                        otherBatches[{peer, prop.targetID}].emplace_back(prop.propertyName, value);
-                    }
+                    properties.emplace_back(name, value);
                 }
+            });
+
+            for (auto& [peer, player] : mPeerToPlayer) {
+                if (isSyncing(peer)) continue;
+                if (cframe) cframeBatches[peer].emplace_back(targetID, *cframe);
+                if (!properties.empty()) SendBatchProperties(peer, targetID, properties);
             }
         }
 
@@ -330,10 +395,6 @@ namespace Nova {
             }
             SendBulkCFrameUpdate(peer, updates);
         }
-
-        for (auto& [batchKey, properties] : otherBatches) {
-            SendBatchProperties(batchKey.peer, batchKey.targetID, properties);
-        }
     }
 
 }
@@ -118,72 +118,50 @@ namespace Nova {
         if (mThread.joinable()) mThread.join();
     }
 
-    void PhysicsService::SetDeferRegistration(bool defer) {
-        std::lock_guard<std::recursive_mutex> lock(mQueueMutex);
-        if (mDeferring && !defer) {
-            if (!mDeferredParts.empty()) {
-                mPendingRegisters.insert(mPendingRegisters.end(), mDeferredParts.begin(), mDeferredParts.end());
-                mDeferredParts.clear();
-            }
-        }
-        mDeferring = defer;
+    std::shared_ptr<BasePart> PhysicsService::SharePart(BasePart* part) {
+        return std::static_pointer_cast<BasePart>(part->weak_from_this().lock());
     }
 
     void PhysicsService::BulkRegisterParts(const std::vector<std::shared_ptr<BasePart>>& parts) {
+        auto self = std::static_pointer_cast<PhysicsService>(shared_from_this());
         std::lock_guard<std::recursive_mutex> lock(mQueueMutex);
-        if (mDeferring) mDeferredParts.insert(mDeferredParts.end(), parts.begin(), parts.end());
-        else mPendingRegisters.insert(mPendingRegisters.end(), parts.begin(), parts.end());
+        {
+            std::unique_lock<std::shared_mutex> mapLock(mMapsMutex);
+            for (auto& part : parts) {
+                if (mPartSlots.Resolve(part->physicsHandle) != part.get()) {
+                    part->physicsHandle = mPartSlots.Acquire(part.get());
+                }
+                part->registeredService = self;
+            }
+        }
+        mPendingRegisters.insert(mPendingRegisters.end(), parts.begin(), parts.end());
     }
 
     void PhysicsService::BulkUnregisterParts(const std::vector<BasePart*>& parts) {
         std::lock_guard<std::recursive_mutex> lock(mQueueMutex);
         std::unique_lock<std::shared_mutex> mapLock(mMapsMutex);
-        for (auto* part : parts) {
-            mPartToJoints.erase(part);
-
-            auto itAss = mPartToAssembly.find(part);
-            if (itAss != mPartToAssembly.end()) {
-                auto assembly = itAss->second;
-                // Don't erase from assembly->parts here, UpdateAssemblies will handle it
-                // because it's a vector of weak_ptrs now.
-
-                // Find first alive part to trigger rebuild
-                for (auto& wp : assembly->parts) {
-                    if (auto alive = wp.lock()) {
-                        if (alive.get() != part) {
-                            mPendingAssemblyUpdates.push_back(alive);
-                            break;
-                        }
-                    }
-                }
-            }
-
-            if (!part->physicsBodyID.IsInvalid()) {
-                uint64_t ptrVal = reinterpret_cast<uint64_t>(part);
-                std::unique_lock<std::shared_mutex> jlock(mJoinedPairsMutex);
-                std::erase_if(mJoinedPairs, [ptrVal](const PartPair& p) {
-                    return p.first == ptrVal || p.second == ptrVal;
-                });
-                part->physicsBodyID = JPH::BodyID();
-            }
-            mPartToAssembly.erase(part);
-        }
+        for (auto* part : parts) UnregisterPartLocked(part);
     }
 
     void PhysicsService::UnregisterPart(BasePart* part) {
         std::lock_guard<std::recursive_mutex> lock(mQueueMutex);
         std::unique_lock<std::shared_mutex> mapLock(mMapsMutex);
+        UnregisterPartLocked(part);
+    }
+
+    void PhysicsService::UnregisterPartLocked(BasePart* part) {
         mPartToJoints.erase(part);
+        mPendingBodyStates.erase(part);
 
+        // The assembly keeps the stale handle until UpdateAssemblies rebuilds it
+        // from the first part that is still alive
         auto itAss = mPartToAssembly.find(part);
         if (itAss != mPartToAssembly.end()) {
-            auto assembly = itAss->second;
-            for (auto& wp : assembly->parts) {
-                if (auto alive = wp.lock()) {
-                    if (alive.get() != part) {
-                        mPendingAssemblyUpdates.push_back(alive);
-                        break;
-                    }
+            for (PartHandle handle : itAss->second->parts) {
+                BasePart* alive = mPartSlots.Resolve(handle);
+                if (alive && alive != part) {
+                    mPendingAssemblyUpdates.push_back(handle);
+                    break;
                 }
             }
         }
@@ -197,6 +175,27 @@ namespace Nova {
             part->physicsBodyID = JPH::BodyID();
         }
         mPartToAssembly.erase(part);
+
+        if (mPartSlots.Resolve(part->physicsHandle) == part) mPartSlots.Release(part->physicsHandle);
+        part->physicsHandle = PartHandle();
+    }
+
+    bool PhysicsService::CaptureBodyState(const BasePart* part, BodyState& state) {
+        if (part->physicsBodyID.IsInvalid()) return false;
+        JPH::BodyInterface& bi = physicsSystem->GetBodyInterface();
+        if (bi.GetMotionType(part->physicsBodyID) != JPH::EMotionType::Dynamic) return false;
+
+        JPH::Vec3 linear = bi.GetLinearVelocity(part->physicsBodyID);
+        JPH::Vec3 angular = bi.GetAngularVelocity(part->physicsBodyID);
+        state.linearVelocity = glm::vec3(linear.GetX(), linear.GetY(), linear.GetZ());
+        state.angularVelocity = glm::vec3(angular.GetX(), angular.GetY(), angular.GetZ());
+        state.active = bi.IsActive(part->physicsBodyID);
+        return true;
+    }
+
+    void PhysicsService::QueueBodyState(const std::shared_ptr<BasePart>& part, const BodyState& state) {
+        std::lock_guard<std::recursive_mutex> lock(mQueueMutex);
+        mPendingBodyStates[part.get()] = { part, state };
     }
 
     void PhysicsService::RegisterConstraint(JointInstance* joint) {
@@ -204,10 +203,25 @@ namespace Nova {
         mPendingConstraints.push_back(std::static_pointer_cast<JointInstance>(joint->shared_from_this()));
     }
 
+    void PhysicsService::RegisterConstraints(const std::vector<std::shared_ptr<JointInstance>>& joints) {
+        std::lock_guard<std::recursive_mutex> lock(mQueueMutex);
+        mPendingConstraints.insert(mPendingConstraints.end(), joints.begin(), joints.end());
+    }
+
     void PhysicsService::UnregisterConstraint(JointInstance* joint) {
         std::lock_guard<std::recursive_mutex> lock(mQueueMutex);
         std::unique_lock<std::shared_mutex> mapLock(mMapsMutex);
+        UnregisterConstraintLocked(joint);
+    }
+
+    void PhysicsService::BulkUnregisterConstraints(const std::vector<JointInstance*>& joints) {
+        if (joints.empty()) return;
+        std::lock_guard<std::recursive_mutex> lock(mQueueMutex);
+        std::unique_lock<std::shared_mutex> mapLock(mMapsMutex);
+        for (auto* joint : joints) UnregisterConstraintLocked(joint);
+    }
 
+    void PhysicsService::UnregisterConstraintLocked(JointInstance* joint) {
         auto p0 = joint->Part0.lock();
         auto p1 = joint->Part1.lock();
         if (p0) {
@@ -247,7 +261,7 @@ namespace Nova {
 
     void PhysicsService::RequestAssemblyUpdate(BasePart* part) {
         std::lock_guard<std::recursive_mutex> lock(mQueueMutex);
-        mPendingAssemblyUpdates.push_back(std::static_pointer_cast<BasePart>(part->shared_from_this()));
+        if (part->physicsHandle.IsValid()) mPendingAssemblyUpdates.push_back(part->physicsHandle);
     }
 
     void PhysicsService::BreakJoints(BasePart* part) {
@@ -274,7 +288,7 @@ namespace Nova {
                             otherJoints.erase(std::remove_if(otherJoints.begin(), otherJoints.end(),
                                 [&](auto& w) { return w.lock() == joint; }), otherJoints.end());
                         }
-                        mPendingAssemblyUpdates.push_back(std::static_pointer_cast<BasePart>(other->shared_from_this()));
+                        mPendingAssemblyUpdates.push_back(other->physicsHandle);
                     }
 
                     if (joint->physicsConstraint) {
@@ -293,23 +307,23 @@ namespace Nova {
             it2->second.clear();
 
             for (auto& req : reqs) {
-                auto p0 = req->part1.lock();
-                auto p1 = req->part2.lock();
+                BasePart* p0 = mPartSlots.Resolve(req->part1);
+                BasePart* p1 = mPartSlots.Resolve(req->part2);
 
-                BasePart* other = (p0.get() == part) ? p1.get() : p0.get();
+                BasePart* other = (p0 == part) ? p1 : p0;
                 if (other) {
                     auto itOther2 = mPartToAutoJoints.find(other);
                     if (itOther2 != mPartToAutoJoints.end()) {
                         auto& otherReqs = itOther2->second;
                         otherReqs.erase(std::remove(otherReqs.begin(), otherReqs.end(), req), otherReqs.end());
                     }
-                    mPendingAssemblyUpdates.push_back(std::static_pointer_cast<BasePart>(other->shared_from_this()));
+                    mPendingAssemblyUpdates.push_back(other->physicsHandle);
                 }
 
                 mInternalJointsToRemove.push_back(req);
 
                 if (p0 && p1) {
-                    PartPair pair = { reinterpret_cast<uint64_t>(p0.get()), reinterpret_cast<uint64_t>(p1.get()) };
+                    PartPair pair = { reinterpret_cast<uint64_t>(p0), reinterpret_cast<uint64_t>(p1) };
                     if (pair.first > pair.second) std::swap(pair.first, pair.second);
                     std::unique_lock<std::shared_mutex> lock_pairs(mJoinedPairsMutex);
                     mJoinedPairs.erase(pair);
@@ -317,7 +331,7 @@ namespace Nova {
             }
         }
 
-        mPendingAssemblyUpdates.push_back(std::static_pointer_cast<BasePart>(part->shared_from_this()));
+        mPendingAssemblyUpdates.push_back(part->physicsHandle);
     }
 
     void PhysicsService::QueueExplosion(glm::vec3 position, float radius, float pressure) {
@@ -363,11 +377,19 @@ namespace Nova {
             network = dm->GetService<NetworkService>();
         }
 
+        // Several physics ticks may land in one Step; listeners hear about each part once
+        static const PropertyID cframeID = ClassDescriptor::Of<BasePart>()->FindPropertyID("CFrame");
+        std::vector<std::shared_ptr<BasePart>> cframeChanged;
+
         std::vector<std::shared_ptr<BasePart>> toRemove;
-        for (const auto& update : updates) {
-            if (auto part = update.part.lock()) {
+        {
+            std::shared_lock<std::shared_mutex> mapLock(mMapsMutex);
+            for (const auto& update : updates) {
+                BasePart* part = mPartSlots.Resolve(update.part);
+                if (!part) continue;
+
                 if (update.position.y < destroyHeight) {
-                    toRemove.push_back(part);
+                    if (auto shared = SharePart(part)) toRemove.push_back(std::move(shared));
                     continue;
                 }
 
@@ -376,6 +398,12 @@ namespace Nova {
 
                 part->cframe.position = update.position;
                 part->cframe.rotation = glm::mat3_cast(update.rotation);
+                if (auto* owner = part->registeredWorkspace) {
+                    owner->partStore.cframes[part->workspaceIndex] = part->cframe;
+                }
+                if (part->HasPropertyListener(cframeID)) {
+                    if (auto shared = SharePart(part)) cframeChanged.push_back(std::move(shared));
+                }
 
                 // Only notify NetworkService if transform changed significantly
                 if (part->networkID != 0 && network) {
@@ -384,7 +412,7 @@ namespace Nova {
                     glm::quat newQ = update.rotation;
                     float rotDelta = 1.0f - glm::abs(glm::dot(oldQ, newQ));
                     if (posDelta > 0.02f || rotDelta > 0.005f) {
-                        network->MarkDirty(part.get(), "CFrame");
+                        network->MarkDirty(part, cframeID);
                     }
                 }
             }
@@ -409,14 +437,20 @@ namespace Nova {
                 CFrame bodyCF;
                 bodyCF.position = glm::vec3(pos.GetX(), pos.GetY(), pos.GetZ());
                 bodyCF.rotation = glm::mat3_cast(glm::quat(rot.GetW(), rot.GetX(), rot.GetY(), rot.GetZ()));
-                for (auto& wp : assembly->parts) {
-                    auto part = wp.lock();
+                for (PartHandle handle : assembly->parts) {
+                    BasePart* part = mPartSlots.Resolve(handle);
                     if (!part || part->networkID == 0) continue;
-                    auto itRel = assembly->relativeTransforms.find(part.get());
+                    auto itRel = assembly->relativeTransforms.find(part);
                     if (itRel == assembly->relativeTransforms.end()) continue;
                     CFrame world = bodyCF * itRel->second;
                     part->cframe = world;
-                    network->MarkDirty(part.get(), "CFrame");
+                    if (auto* owner = part->registeredWorkspace) {
+                        owner->partStore.cframes[part->workspaceIndex] = world;
+                    }
+                    network->MarkDirty(part, cframeID);
+                    if (part->HasPropertyListener(cframeID)) {
+                        if (auto shared = SharePart(part)) cframeChanged.push_back(std::move(shared));
+                    }
                 }
             }
         }
@@ -435,13 +469,16 @@ namespace Nova {
             for (auto& p : toRemove) rawParts.push_back(p.get());
             BulkUnregisterParts(rawParts);
             for (auto& part : toRemove) {
-                if (auto p = part->parent.lock()) {
-                    auto& c = p->children;
-                    c.erase(std::remove(c.begin(), c.end(), part), c.end());
-                }
-                part->parent.reset();
+                part->DetachSilently();
+            }
+        }
+
+        if (!cframeChanged.empty()) {
+            std::sort(cframeChanged.begin(), cframeChanged.end());
+            cframeChanged.erase(std::unique(cframeChanged.begin(), cframeChanged.end()), cframeChanged.end());
+            for (auto& part : cframeChanged) {
+                part->NotifyPropertyChanged(cframeID);
             }
-            if (ws) ws->RefreshCachedParts();
         }
 
         std::vector<ContactEvent> contacts;
@@ -449,9 +486,21 @@ namespace Nova {
             std::lock_guard<std::mutex> lock(mContactMutex);
             contacts.swap(mContactBuffer);
         }
-        for (const auto& contact : contacts) {
-            auto p1 = contact.part1.lock();
-            auto p2 = contact.part2.lock();
+        if (contacts.empty()) return;
+
+        // Touched hands both parts to Lua, so this is where they become shared_ptrs.
+        // Pairs are filtered after the lock drops in case one of them is the last reference.
+        std::vector<std::pair<std::shared_ptr<BasePart>, std::shared_ptr<BasePart>>> touches;
+        {
+            std::shared_lock<std::shared_mutex> mapLock(mMapsMutex);
+            touches.reserve(contacts.size());
+            for (const auto& contact : contacts) {
+                BasePart* p1 = mPartSlots.Resolve(contact.part1);
+                BasePart* p2 = mPartSlots.Resolve(contact.part2);
+                if (p1 && p2) touches.emplace_back(SharePart(p1), SharePart(p2));
+            }
+        }
+        for (auto& [p1, p2] : touches) {
             if (p1 && p2) {
                 p1->Touched.fire(p2);
                 p2->Touched.fire(p1);
@@ -490,17 +539,13 @@ namespace Nova {
             CFrame bodyCF;
             bodyCF.position = glm::vec3(pos.GetX(), pos.GetY(), pos.GetZ());
             bodyCF.rotation = glm::mat3_cast(glm::quat(rot.GetW(), rot.GetX(), rot.GetY(), rot.GetZ()));
-            for (auto& wp : assembly->parts) {
-                auto part = wp.lock();
+            for (PartHandle handle : assembly->parts) {
+                BasePart* part = mPartSlots.Resolve(handle);
                 if (!part) continue;
-                auto itRel = assembly->relativeTransforms.find(part.get());
+                auto itRel = assembly->relativeTransforms.find(part);
                 if (itRel == assembly->relativeTransforms.end()) continue;
                 CFrame world = bodyCF * itRel->second;
-                TransformUpdate update;
-                update.part = part;
-                update.position = world.position;
-                update.rotation = glm::quat_cast(world.rotation);
-                updates.push_back(std::move(update));
+                updates.push_back({ handle, world.position, glm::quat_cast(world.rotation) });
             }
         }
         {
@@ -8,9 +8,11 @@
 
 #pragma once
 #include "Engine/Objects/Instance.hpp"
+#include "Engine/Services/ServiceID.hpp"
 #include "Common/MathTypes.hpp"
 #include "Engine/Physics/Assembly.hpp"
 #include "Engine/Physics/JoltLayers.hpp"
+#include "Engine/Physics/PartHandle.hpp"
 #include <Jolt/Jolt.h>
 #include <Jolt/Physics/PhysicsSystem.h>
 #include <Jolt/Physics/Body/BodyInterface.h>
@@ -35,20 +37,21 @@ namespace Nova {
     enum class SurfaceType : int;
     class ContactListenerImpl;
 
+    // Handles in these buffers are resolved against PhysicsService::mPartSlots
     struct TransformUpdate {
-        std::weak_ptr<BasePart> part;
+        PartHandle part;
         glm::vec3 position;
         glm::quat rotation;
     };
 
     struct ContactEvent {
-        std::weak_ptr<BasePart> part1;
-        std::weak_ptr<BasePart> part2;
+        PartHandle part1;
+        PartHandle part2;
     };
 
     struct JointRequest {
-        std::weak_ptr<BasePart> part1;
-        std::weak_ptr<BasePart> part2;
+        PartHandle part1;
+        PartHandle part2;
         SurfaceType surface1;
         SurfaceType surface2;
         JPH::Constraint* physicsConstraint = nullptr;
@@ -59,8 +62,10 @@ namespace Nova {
         PhysicsService();
         ~PhysicsService();
 
+        static constexpr ServiceID StaticServiceID = ServiceID::PhysicsService;
+
         std::string GetClassName() const override { return "PhysicsService"; }
-        std::string GetName() const override { return m_debugName; }
+        const std::string& GetName() const override { return m_debugName; }
 
         // Async Physics Management
         void Start();
@@ -76,15 +81,13 @@ namespace Nova {
 
         // Joint Management
         void RegisterConstraint(JointInstance* joint);
+        void RegisterConstraints(const std::vector<std::shared_ptr<JointInstance>>& joints);
         void UnregisterConstraint(JointInstance* joint);
+        void BulkUnregisterConstraints(const std::vector<JointInstance*>& joints);
 
         JPH::PhysicsSystem* GetPhysicsSystem() { return physicsSystem; }
         std::recursive_mutex& GetPhysicsMutex() { return mPhysicsMutex; }
 
-        // Performance Optimization: Defer registration during level load
-        void SetDeferRegistration(bool defer);
-        bool IsDeferring() const { return mDeferring; }
-
         // Deduplication helper
         bool HasJointBetween(BasePart* p1, BasePart* p2);
 
@@ -105,9 +108,22 @@ namespace Nova {
         std::vector<std::pair<std::shared_ptr<BasePart>, float>> ApplyExplosionImpulse(
             glm::vec3 position, float radius, float pressure);
 
+        // Motion of the body a part belongs to, saved by checkpoints. Positions
+        // travel as the parts' CFrames.
+        struct BodyState {
+            glm::vec3 linearVelocity{0.0f};
+            glm::vec3 angularVelocity{0.0f};
+            bool active = true;
+        };
+        // False if the part has no dynamic body. Caller holds GetPhysicsMutex().
+        bool CaptureBodyState(const BasePart* part, BodyState& state);
+        // Applied when the part's assembly body is next built, i.e. right after
+        // a restored part registers. Dropped if the part dies first.
+        void QueueBodyState(const std::shared_ptr<BasePart>& part, const BodyState& state);
+
         struct InternalJoint {
-            std::weak_ptr<BasePart> part1;
-            std::weak_ptr<BasePart> part2;
+            PartHandle part1;
+            PartHandle part2;
             JPH::Constraint* physicsConstraint = nullptr;
         };
 
@@ -121,6 +137,13 @@ namespace Nova {
         std::unordered_map<BasePart*, std::shared_ptr<Assembly>> mPartToAssembly;
         mutable std::shared_mutex mMapsMutex;
 
+        // Registered parts; guarded by mMapsMutex like the maps above
+        PartSlotTable mPartSlots;
+        BasePart* ResolvePart(PartHandle handle) const { return mPartSlots.Resolve(handle); }
+
+        // Only for handing a resolved part to Lua; null once the part is being destroyed
+        static std::shared_ptr<BasePart> SharePart(BasePart* part);
+
         // Publicly accessible buffers for the contact listener/internal managers
         std::mutex mContactMutex;
         std::vector<ContactEvent> mContactBuffer;
@@ -133,8 +156,13 @@ namespace Nova {
         std::vector<JointRequest> mPendingAutoJoints;
         std::vector<std::shared_ptr<InternalJoint>> mInternalJointsToRemove;
         std::vector<std::shared_ptr<InternalJoint>> mActiveAutoJoints;
-        std::vector<std::weak_ptr<BasePart>> mPendingAssemblyUpdates;
+        std::vector<PartHandle> mPendingAssemblyUpdates;
         std::vector<std::shared_ptr<JointInstance>> mPendingJointDestructions; // For thread-safe scene tree cleanup
+        struct PendingBodyState {
+            std::weak_ptr<BasePart> part;  // Expired once the part dies, so a reused address never matches
+            BodyState state;
+        };
+        std::unordered_map<BasePart*, PendingBodyState> mPendingBodyStates;
 
         using PartPair = std::pair<uint64_t, uint64_t>;
         struct PartPairHasher {
@@ -163,6 +191,10 @@ namespace Nova {
         void ProcessQueuedMutations(); 
         void UpdateAssemblies();       
 
+        // Caller holds mQueueMutex and mMapsMutex exclusively
+        void UnregisterConstraintLocked(JointInstance* joint);
+        void UnregisterPartLocked(BasePart* part);
+
         // Jolt Boilerplate
         JPH::PhysicsSystem* physicsSystem;
         JPH::TempAllocatorImpl* tempAllocator;
@@ -184,10 +216,6 @@ namespace Nova {
         };
         std::vector<ExplosionRequest> mPendingExplosions;
 
-        // Deferred registration state
-        bool mDeferring = false;
-        std::vector<std::shared_ptr<BasePart>> mDeferredParts;
-
         // Jolt implementation classes
         std::unique_ptr<BPLInterfaceImpl> bp_interface;
         std::unique_ptr<ObjectVsBroadPhaseLayerFilterImpl> obp_filter;
@@ -189,9 +189,13 @@ namespace Nova {
         luabridge::getGlobalNamespace(L)
             .beginClass<CFrame>("CFrame")
                 .addConstructor<void(*)(void)>()
-                .addStaticFunction("new", +[]() { return CFrame(); })
+                .addStaticFunction("new",
+                    +[]() { return CFrame(); },
+                    +[](float x, float y, float z) { return CFrame(Vector3(x, y, z)); })
                 .addProperty("p", &CFrame::position)
                 .addProperty("Position", &CFrame::position)
+                .addFunction("inverse", &CFrame::inverse)
+                .addFunction("__mul", &CFrame::operator*)
             .endClass();
 
         // Instance class — LuaIndex/LuaNewIndex handle all property/method access
@@ -206,12 +210,6 @@ namespace Nova {
                             auto res = parent.cast<std::shared_ptr<Instance>>();
                             if (res) {
                                 inst->SetParent(res.value());
-
-                                if (auto dm = inst->GetDataModel()) {
-                                    if (auto ws = dm->GetService<Workspace>()) {
-                                        if (inst->IsDescendantOf(ws)) ws->RefreshCachedParts();
-                                    }
-                                }
                             }
                         }
                         lua_pop(L, 1);
@@ -229,11 +227,13 @@ namespace Nova {
                 .addFunction("FindFirstAncestorWhichIsA", &Instance::FindFirstAncestorWhichIsA)
                 .addFunction("GetDescendants", &Instance::GetDescendants)
                 .addFunction("getDescendants", &Instance::GetDescendants)
+                .addFunction("IterDescendants", &Instance::LuaIterDescendants)
                 .addFunction("GetFullName", &Instance::GetFullName)
-                .addFunction("IsA", &Instance::IsA)
-                .addFunction("isA", &Instance::IsA)
-                .addFunction("Clone", &Instance::Clone)
-                .addFunction("clone", &Instance::Clone)
+                .addFunction("GetPropertyChangedSignal", &Instance::GetPropertyChangedSignal)
+                .addFunction("IsA", static_cast<bool(Instance::*)(const std::string&)>(&Instance::IsA))
+                .addFunction("isA", static_cast<bool(Instance::*)(const std::string&)>(&Instance::IsA))
+                .addFunction("Clone", static_cast<std::shared_ptr<Instance>(Instance::*)()>(&Instance::Clone))
+                .addFunction("clone", static_cast<std::shared_ptr<Instance>(Instance::*)()>(&Instance::Clone))
                 .addFunction("Destroy", &Instance::Destroy)
                 .addFunction("destroy", &Instance::Destroy)
                 .addIndexMetaMethod(Instance::LuaIndex)
@@ -8,6 +8,7 @@
 
 #pragma once
 #include "Engine/Objects/Instance.hpp"
+#include "Engine/Services/ServiceID.hpp"
 #include <lua.h>
 #include <lualib.h>
 
@@ -30,8 +31,10 @@ namespace Nova {
         ScriptContext();
         ~ScriptContext();
 
+        static constexpr ServiceID StaticServiceID = ServiceID::ScriptContext;
+
         std::string GetClassName() const override { return "ScriptContext"; }
-        std::string GetName() const override { return m_debugName; }
+        const std::string& GetName() const override { return m_debugName; }
 
         void Execute(const std::string& source, const std::string& chunkName = "script");
         void SetDataModel(std::shared_ptr<DataModel> dataModel);
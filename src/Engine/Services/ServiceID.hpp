@@ -0,0 +1,37 @@
+// Nova Game Engine
+// Copyright (C) 2026  brambora69123
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+
+namespace Nova {
+    // Slots in DataModel's service table. Each service class exposes its slot
+    // as T::StaticServiceID for GetService<T>().
+    enum class ServiceID : uint8_t {
+        Workspace,
+        Lighting,
+        ScriptContext,
+        PhysicsService,
+        NetworkService,
+        Count
+    };
+
+    inline constexpr size_t ServiceCount = static_cast<size_t>(ServiceID::Count);
+
+    // Maps a class name to its slot, or ServiceID::Count for uncached classes
+    constexpr ServiceID ServiceIDFromClassName(std::string_view className) {
+        if (className == "Workspace") return ServiceID::Workspace;
+        if (className == "Lighting") return ServiceID::Lighting;
+        if (className == "ScriptContext") return ServiceID::ScriptContext;
+        if (className == "PhysicsService") return ServiceID::PhysicsService;
+        if (className == "NetworkService") return ServiceID::NetworkService;
+        return ServiceID::Count;
+    }
+}
@@ -11,21 +11,53 @@
 
 namespace Nova {
 
-    static void FindAllPartsRecursive(std::shared_ptr<Instance> inst, std::vector<std::shared_ptr<BasePart>>& out) {
-        if (!inst) return;
+    void Workspace::OnDescendantAdded(const std::shared_ptr<Instance>& root) {
+        auto add = [this](const std::shared_ptr<Instance>& inst) {
+            if (inst->IsA<BasePart>()) RegisterPart(std::static_pointer_cast<BasePart>(inst));
+        };
+        add(root);
+        root->ForEachDescendant(add);
+    }
 
-        if (auto part = std::dynamic_pointer_cast<BasePart>(inst)) {
-            out.push_back(part);
-        }
+    void Workspace::OnDescendantRemoving(const std::shared_ptr<Instance>& root) {
+        auto remove = [this](const std::shared_ptr<Instance>& inst) {
+            if (inst->IsA<BasePart>()) UnregisterPart(static_cast<BasePart*>(inst.get()));
+        };
+        remove(root);
+        root->ForEachDescendant(remove);
+    }
 
-        for (auto& child : inst->GetChildren()) {
-            FindAllPartsRecursive(child, out);
+    void Workspace::RegisterPart(const std::shared_ptr<BasePart>& part) {
+        if (part->workspaceIndex != BasePart::InvalidWorkspaceIndex) return;
+        part->workspaceIndex = static_cast<uint32_t>(cachedParts.size());
+        part->registeredWorkspace = this;
+        cachedParts.push_back(part);
+        partStore.Append(*part);
+    }
+
+    void Workspace::UnregisterPart(BasePart* part) {
+        uint32_t index = part->workspaceIndex;
+        if (index >= cachedParts.size() || cachedParts[index].get() != part) return;
+
+        // Swap-remove: the last part takes over the freed slot
+        if (index != cachedParts.size() - 1) {
+            cachedParts[index] = std::move(cachedParts.back());
+            cachedParts[index]->workspaceIndex = index;
         }
+        cachedParts.pop_back();
+        partStore.SwapRemove(index);
+        part->workspaceIndex = BasePart::InvalidWorkspaceIndex;
+        part->registeredWorkspace = nullptr;
     }
 
-    void Workspace::RefreshCachedParts() {
+    void Workspace::OnDestroying(DestroyBatch& batch) {
+        // Every registered part goes with the Workspace; drop the registry wholesale
+        for (auto& part : cachedParts) {
+            part->workspaceIndex = BasePart::InvalidWorkspaceIndex;
+            part->registeredWorkspace = nullptr;
+        }
         cachedParts.clear();
-        FindAllPartsRecursive(shared_from_this(), cachedParts);
+        partStore.Clear();
     }
 
 }
@@ -8,7 +8,9 @@
 
 #pragma once
 #include "Engine/Objects/Instance.hpp"
+#include "Engine/Services/ServiceID.hpp"
 #include "Engine/Objects/Camera.hpp"
+#include "Engine/Objects/PartStore.hpp"
 #include <vector>
 #include <memory>
 
@@ -20,13 +22,27 @@ namespace Nova {
         float FallenPartsDestroyHeight = -500.0f;
 
         std::shared_ptr<Camera> CurrentCamera;
+
+        // Every BasePart under this Workspace. Maintained incrementally by
+        // Instance::SetParent; each part stores its slot in workspaceIndex.
         std::vector<std::shared_ptr<BasePart>> cachedParts;
 
+        // Hot state of cachedParts, slot for slot
+        PartStore partStore;
+
         Workspace() : Instance("Workspace") {}
 
-        void RefreshCachedParts();
+        void OnDescendantAdded(const std::shared_ptr<Instance>& root);
+        void OnDescendantRemoving(const std::shared_ptr<Instance>& root);
+
+        void RegisterPart(const std::shared_ptr<BasePart>& part);
+        void UnregisterPart(BasePart* part);
+
+        void OnDestroying(DestroyBatch& batch) override;
+
+        static constexpr ServiceID StaticServiceID = ServiceID::Workspace;
 
         std::string GetClassName() const override { return "Workspace"; }
-        std::string GetName() const override { return m_debugName; }
+        const std::string& GetName() const override { return m_debugName; }
     };
 }
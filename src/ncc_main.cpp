@@ -10,17 +10,24 @@
 #include "Engine/Nova.hpp"
 #include "Common/Log.hpp"
 #include <cstring>
+#include <filesystem>
 #include <string>
 
 int main(int argc, char* argv[]) {
     std::string level = "./resources/Places/RobloxHQ.rbxl";
     uint16_t port = 27015;
+    std::string checkpoint;
+    double checkpointInterval = 60.0;
 
     for (int i = 1; i < argc; i++) {
         if (strcmp(argv[i], "--level") == 0 && i + 1 < argc) {
             level = argv[++i];
         } else if (strcmp(argv[i], "--port") == 0 && i + 1 < argc) {
             port = static_cast<uint16_t>(atoi(argv[++i]));
+        } else if (strcmp(argv[i], "--checkpoint") == 0 && i + 1 < argc) {
+            checkpoint = argv[++i];
+        } else if (strcmp(argv[i], "--checkpoint-interval") == 0 && i + 1 < argc) {
+            checkpointInterval = atof(argv[++i]);
         }
     }
 
@@ -30,7 +37,18 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
-    engine.LoadLevel(level);
+    // A restarted server resumes from its last checkpoint instead of the place file
+    std::error_code ec;
+    bool resumed = !checkpoint.empty() && std::filesystem::exists(checkpoint, ec);
+    if (resumed) {
+        LOG_INF("NCCService", "Resuming from checkpoint '%s'", checkpoint.c_str());
+        engine.LoadLevel(checkpoint);
+    } else {
+        engine.LoadLevel(level);
+    }
+    if (!checkpoint.empty()) {
+        engine.EnableAutosave(checkpoint, checkpointInterval);
+    }
 
     // Run test scripts on server
     auto scriptContext = engine.GetDataModel()->GetService<Nova::ScriptContext>();
@@ -39,8 +57,8 @@ int main(int argc, char* argv[]) {
     scriptContext->Execute("print('Server: Game name: ' .. game.Name)");
     scriptContext->Execute("print('Server: Workspace name: ' .. workspace.Name)");
 
-    // Explosion test script
-    scriptContext->Execute(R"(
+    // Explosion test script; a resumed world already has its part
+    if (!resumed) scriptContext->Execute(R"(
         local touched = false
         local p = Instance.new("Part")
         p.Name = "ExplosionTestPart"
@@ -0,0 +1,61 @@
+// Nova Game Engine - minimal test harness
+// Shared by every test target. Tests register into a list and run from main,
+// so engine tests can register classes first.
+
+#pragma once
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace NovaTest {
+    struct Case {
+        const char* name;
+        void (*fn)();
+    };
+
+    inline std::vector<Case>& Cases() {
+        static std::vector<Case> cases;
+        return cases;
+    }
+
+    inline int passed = 0;
+    inline int failed = 0;
+
+    inline int RunAll(const char* title) {
+        printf("\n=== %s ===\n\n", title);
+        for (auto& test : Cases()) {
+            printf("  %-50s", test.name);
+            test.fn();
+        }
+        printf("\nResults: %d passed, %d failed\n\n", passed, failed);
+        return failed > 0 ? 1 : 0;
+    }
+}
+
+#define TEST(name) \
+    static void test_##name(); \
+    static const bool registered_##name = (NovaTest::Cases().push_back({ #name, test_##name }), true); \
+    static void test_##name()
+
+#define ASSERT_EQ(a, b) do { \
+    if ((a) != (b)) { \
+        printf("FAIL\n    %s:%d: %s != %s\n", __FILE__, __LINE__, #a, #b); \
+        NovaTest::failed++; return; \
+    } \
+} while(0)
+
+#define ASSERT_NEAR(a, b, eps) do { \
+    if (std::fabs((a) - (b)) > (eps)) { \
+        printf("FAIL\n    %s:%d: %s (%f) !~= %s (%f)\n", __FILE__, __LINE__, #a, (double)(a), #b, (double)(b)); \
+        NovaTest::failed++; return; \
+    } \
+} while(0)
+
+#define ASSERT_TRUE(x) do { \
+    if (!(x)) { \
+        printf("FAIL\n    %s:%d: %s\n", __FILE__, __LINE__, #x); \
+        NovaTest::failed++; return; \
+    } \
+} while(0)
+
+#define PASS() do { printf("OK\n"); NovaTest::passed++; } while(0)
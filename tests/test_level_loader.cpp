@@ -0,0 +1,302 @@
+// Nova Game Engine - LevelLoader Tests
+// Decodes a small fixture place through the in-place XML path and checks every
+// property and reference against the values the file spells out, then checks
+// the binary path loads the same tree. A generated place is then loaded into
+// live DataModels, where parts built on the worker threads must end up in the
+// Workspace registry, the PartStore and physics.
+
+#include "TestHarness.hpp"
+#include "Engine/Nova.hpp"
+#include "Engine/Objects/InstanceFactory.hpp"
+#include "Engine/Reflection/ClassDescriptor.hpp"
+#include "Engine/Reflection/LevelLoader.hpp"
+#include "Common/BinaryStream.hpp"
+#include "PlaceGenerator.hpp"
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace Nova;
+
+// Covers legacy property names, lower camel references, null and dangling
+// references, XML entities, both Color3 spellings, and unknown classes and
+// properties, which are skipped
+static const char* FixturePlace = R"(<roblox version="4">
+<Item class="Workspace" referent="RBX0"><Properties>
+  <string name="Name">Workspace</string>
+  <float name="FallenPartsDestroyHeight">-100</float>
+</Properties>
+  <Item class="Model" referent="RBX1"><Properties>
+    <string name="Name">Car</string>
+    <Ref name="PrimaryPart">RBX3</Ref>
+  </Properties>
+    <Item class="Part" referent="RBX2"><Properties>
+      <string name="Name">Base</string>
+      <bool name="anchored">true</bool>
+      <int name="BrickColor">21</int>
+      <CoordinateFrame name="CoordinateFrame"><X>1</X><Y>2</Y><Z>3</Z>
+        <R00>0</R00><R01>-1</R01><R02>0</R02><R10>1</R10><R11>0</R11><R12>0</R12>
+        <R20>0</R20><R21>0</R21><R22>1</R22></CoordinateFrame>
+      <Vector3 name="size"><X>8</X><Y>1.2</Y><Z>4</Z></Vector3>
+      <token name="TopSurface">0</token>
+      <float name="Transparency">0.5</float>
+      <string name="NoSuchProperty">ignored</string>
+    </Properties></Item>
+    <Item class="Part" referent="RBX3"><Properties>
+      <string name="Name">Top</string>
+      <bool name="CanCollide">false</bool>
+    </Properties>
+      <Item class="Weld" referent="RBX4"><Properties>
+        <string name="Name">Weld</string>
+        <Ref name="Part0">RBX2</Ref>
+        <Ref name="part1">RBX3</Ref>
+        <CoordinateFrame name="C0"><X>0</X><Y>0.6</Y><Z>0</Z>
+          <R00>1</R00><R01>0</R01><R02>0</R02><R10>0</R10><R11>1</R11><R12>0</R12>
+          <R20>0</R20><R21>0</R21><R22>1</R22></CoordinateFrame>
+      </Properties></Item>
+      <Item class="Weld" referent="RBX5"><Properties>
+        <string name="Name">Loose</string>
+        <Ref name="Part0">null</Ref>
+        <Ref name="Part1">RBX99</Ref>
+      </Properties></Item>
+    </Item>
+  </Item>
+  <Item class="NoSuchClass" referent="RBX6"><Properties><string name="Name">Ghost</string></Properties></Item>
+  <Item class="Script" referent="RBX7"><Properties>
+    <string name="Name">Boot</string>
+    <string name="Source">if a &lt; b then print("x") end</string>
+    <bool name="Disabled">true</bool>
+  </Properties></Item>
+</Item>
+<Item class="Lighting" referent="RBX8"><Properties>
+  <Color3 name="TopAmbientV9">16711680</Color3>
+  <Color3 name="BottomAmbientV9">0.25,0.5,1</Color3>
+  <string name="TimeOfDay">06:30:00</string>
+</Properties></Item>
+</roblox>
+)";
+
+static std::string TempPath(const char* name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+static std::shared_ptr<Instance> LoadFixture() {
+    std::string path = TempPath("nova_loader_fixture.rbxl");
+    std::ofstream(path, std::ios::trunc) << FixturePlace;
+    auto root = InstanceFactory::Get().Create("Model");
+    LevelLoader::Load(path, root);
+    std::filesystem::remove(path);
+    return root;
+}
+
+static void Flatten(const std::shared_ptr<Instance>& root, std::vector<std::shared_ptr<Instance>>& out) {
+    out.push_back(root);
+    for (auto& child : root->GetChildren()) Flatten(child, out);
+}
+
+template<typename T>
+static std::shared_ptr<T> Find(const std::shared_ptr<Instance>& root, const std::string& name) {
+    return std::static_pointer_cast<T>(root->FindFirstChild(name, true));
+}
+
+TEST(xml_properties) {
+    auto root = LoadFixture();
+    auto workspace = Find<Workspace>(root, "Workspace");
+    ASSERT_TRUE(workspace != nullptr);
+    ASSERT_NEAR(workspace->FallenPartsDestroyHeight, -100.0f, 1e-6f);
+
+    auto base = Find<Part>(root, "Base");
+    ASSERT_TRUE(base != nullptr);
+    ASSERT_EQ(base->anchored, true);
+    ASSERT_EQ(base->brickColor, 21);
+    ASSERT_NEAR(base->cframe.position.x, 1.0f, 1e-6f);
+    ASSERT_NEAR(base->cframe.position.z, 3.0f, 1e-6f);
+    // R01 is row 0, column 1; GLM indexes column first
+    ASSERT_NEAR(base->cframe.rotation[1][0], -1.0f, 1e-6f);
+    ASSERT_NEAR(base->cframe.rotation[0][1], 1.0f, 1e-6f);
+    ASSERT_NEAR(base->cframe.rotation[2][2], 1.0f, 1e-6f);
+    ASSERT_NEAR(base->size.x, 8.0f, 1e-6f);
+    ASSERT_NEAR(base->size.y, 1.2f, 1e-6f);
+    ASSERT_TRUE(base->topSurface == SurfaceType::Smooth);
+    ASSERT_NEAR(base->transparency, 0.5f, 1e-6f);
+
+    auto top = Find<Part>(root, "Top");
+    ASSERT_TRUE(top != nullptr);
+    ASSERT_EQ(top->canCollide, false);
+    ASSERT_EQ(top->anchored, false);
+
+    auto script = Find<Script>(root, "Boot");
+    ASSERT_TRUE(script != nullptr);
+    ASSERT_EQ(script->Source, std::string("if a < b then print(\"x\") end"));
+    ASSERT_EQ(script->Disabled, true);
+
+    auto lighting = Find<Lighting>(root, "Lighting");
+    ASSERT_TRUE(lighting != nullptr);
+    ASSERT_NEAR(lighting->TopAmbientV9.x, 1.0f, 1e-6f);
+    ASSERT_NEAR(lighting->TopAmbientV9.y, 0.0f, 1e-6f);
+    ASSERT_NEAR(lighting->BottomAmbientV9.y, 0.5f, 1e-6f);
+    ASSERT_NEAR(lighting->BottomAmbientV9.z, 1.0f, 1e-6f);
+    ASSERT_EQ(lighting->TimeOfDay, std::string("06:30:00"));
+
+    ASSERT_TRUE(root->FindFirstChild("Ghost", true) == nullptr);
+    PASS();
+}
+
+TEST(xml_references) {
+    auto root = LoadFixture();
+    auto model = Find<Model>(root, "Car");
+    auto base = Find<Part>(root, "Base");
+    auto top = Find<Part>(root, "Top");
+    ASSERT_TRUE(model && base && top);
+    ASSERT_TRUE(model->PrimaryPart.lock() == top);
+
+    auto weld = Find<Weld>(root, "Weld");
+    ASSERT_TRUE(weld != nullptr);
+    ASSERT_TRUE(weld->Part0.lock() == base);
+    ASSERT_TRUE(weld->Part1.lock() == top);
+    ASSERT_NEAR(weld->c0.position.y, 0.6f, 1e-6f);
+
+    auto loose = Find<Weld>(root, "Loose");
+    ASSERT_TRUE(loose != nullptr);
+    ASSERT_TRUE(loose->Part0.expired());
+    ASSERT_TRUE(loose->Part1.expired());
+    PASS();
+}
+
+TEST(binary_matches_xml) {
+    auto xml = LoadFixture();
+    std::string path = TempPath("nova_loader_fixture.nvpl");
+    ASSERT_TRUE(LevelLoader::SaveBinary(path, xml));
+    auto binary = InstanceFactory::Get().Create("Model");
+    LevelLoader::Load(path, binary);
+    std::filesystem::remove(path);
+
+    std::vector<std::shared_ptr<Instance>> left, right;
+    Flatten(xml, left);
+    Flatten(binary, right);
+    ASSERT_EQ(left.size(), right.size());
+
+    std::unordered_map<const Instance*, size_t> leftIndex, rightIndex;
+    for (size_t i = 0; i < left.size(); i++) {
+        leftIndex[left[i].get()] = i;
+        rightIndex[right[i].get()] = i;
+    }
+
+    for (size_t i = 0; i < left.size(); i++) {
+        ASSERT_EQ(left[i]->GetClassName(), right[i]->GetClassName());
+        ASSERT_EQ(left[i]->GetName(), right[i]->GetName());
+        auto* desc = left[i]->GetDescriptor();
+        if (!desc) continue;
+        for (auto& property : desc->flatProperties) {
+            BinaryWriter a, b;
+            property.accessor->write(a, left[i].get());
+            property.accessor->write(b, right[i].get());
+            ASSERT_TRUE(a.GetData() == b.GetData());
+        }
+        for (auto& reference : desc->flatReferences) {
+            auto a = reference.accessor->get(left[i].get());
+            auto b = reference.accessor->get(right[i].get());
+            ASSERT_EQ(a == nullptr, b == nullptr);
+            if (a) ASSERT_EQ(leftIndex.at(a.get()), rightIndex.at(b.get()));
+        }
+    }
+    PASS();
+}
+
+// A few thousand parts in nested models, half of them welded, so the parallel
+// loader splits the Workspace into many units
+static std::string WriteGeneratedPlace(PlaceGenerator::Stats& stats) {
+    PlaceGenerator::Options options;
+    options.parts = 3000;
+    options.modelDepth = 2;
+    options.clusterSize = 25;
+    options.anchored = 0.5f;
+    std::string path = TempPath("nova_loader_generated.rbxl");
+    std::ofstream out(path, std::ios::trunc);
+    stats = PlaceGenerator::WriteXml(out, options);
+    return path;
+}
+
+static size_t CountOfClass(const std::shared_ptr<Instance>& root, const std::string& className) {
+    size_t count = 0;
+    for (auto& child : root->GetChildren()) {
+        if (child->GetClassName() == className) count++;
+    }
+    return count;
+}
+
+// One Workspace, holding every loaded part in its registry and store, each
+// registered with the DataModel's physics
+static bool LiveWorldMatches(const std::shared_ptr<DataModel>& dm, int expectedParts) {
+    auto* ws = dm->FindService<Workspace>();
+    auto* physics = dm->FindService<PhysicsService>();
+    if (!ws || !physics || CountOfClass(dm, "Workspace") != 1) return false;
+    if (ws->cachedParts.size() != size_t(expectedParts) || ws->partStore.Size() != size_t(expectedParts)) return false;
+
+    size_t seen = 0;
+    bool ok = true;
+    ws->ForEachDescendant([&](const std::shared_ptr<Instance>& inst) {
+        if (!inst->IsA<BasePart>()) return;
+        auto* part = static_cast<BasePart*>(inst.get());
+        seen++;
+        uint32_t i = part->workspaceIndex;
+        if (part->registeredWorkspace != ws || i >= ws->cachedParts.size() || ws->cachedParts[i].get() != part) ok = false;
+        else if (ws->partStore.cframes[i].position != part->cframe.position || ws->partStore.sizes[i] != part->GetSize()) ok = false;
+        if (!part->IsPhysicsRegistered() || part->registeredService.lock().get() != physics) ok = false;
+        if (!part->IsInWorkspace() || part->GetDataModel() != dm.get()) ok = false;
+    });
+    return ok && seen == size_t(expectedParts);
+}
+
+TEST(xml_into_live_datamodel) {
+    PlaceGenerator::Stats stats;
+    std::string path = WriteGeneratedPlace(stats);
+
+    // The usual engine start: services exist before the place is loaded
+    auto dm = std::make_shared<DataModel>();
+    auto ws = dm->GetService<Workspace>();
+    dm->GetService<PhysicsService>();
+    LevelLoader::Load(path, dm);
+    std::filesystem::remove(path);
+
+    ASSERT_TRUE(dm->FindService<Workspace>() == ws.get());
+    ASSERT_TRUE(LiveWorldMatches(dm, stats.parts));
+
+    size_t welds = 0;
+    ws->ForEachDescendant([&](const std::shared_ptr<Instance>& inst) {
+        if (inst->GetClassName() == "Weld") welds++;
+    });
+    ASSERT_EQ(welds, size_t(stats.joints));
+    PASS();
+}
+
+TEST(binary_into_live_datamodel) {
+    PlaceGenerator::Stats stats;
+    std::string xmlPath = WriteGeneratedPlace(stats);
+    auto source = InstanceFactory::Get().Create("Model");
+    LevelLoader::Load(xmlPath, source);
+    std::filesystem::remove(xmlPath);
+    std::string path = TempPath("nova_loader_generated.nvpl");
+    ASSERT_TRUE(LevelLoader::SaveBinary(path, source));
+
+    // Merged into a live Workspace by AttachPlace
+    auto live = std::make_shared<DataModel>();
+    auto ws = live->GetService<Workspace>();
+    LevelLoader::Load(path, live);
+    ASSERT_TRUE(live->FindService<Workspace>() == ws.get());
+    ASSERT_TRUE(LiveWorldMatches(live, stats.parts));
+
+    // Parented whole into a DataModel that has no Workspace yet
+    auto fresh = std::make_shared<DataModel>();
+    LevelLoader::Load(path, fresh);
+    std::filesystem::remove(path);
+    ASSERT_TRUE(LiveWorldMatches(fresh, stats.parts));
+    PASS();
+}
+
+int main() {
+    RegisterClasses();
+    return NovaTest::RunAll("Nova LevelLoader Tests");
+}
@@ -1,6 +1,7 @@
 // Nova Game Engine - Replication System Tests
 // Tests packet serialization roundtrips, protocol correctness, and client-server parity.
 
+#include "TestHarness.hpp"
 #include "Engine/Networking/ReplicationProtocol.hpp"
 #include "Engine/Networking/NetworkID.hpp"
 #include "Common/PropertyValue.hpp"
@@ -14,40 +15,6 @@
 
 using namespace Nova;
 
-static int testsPassed = 0;
-static int testsFailed = 0;
-
-#define TEST(name) \
-    static void test_##name(); \
-    struct TestRunner_##name { TestRunner_##name() { \
-        printf("  %-50s", #name); \
-        test_##name(); \
-    }} runner_##name; \
-    static void test_##name()
-
-#define ASSERT_EQ(a, b) do { \
-    if ((a) != (b)) { \
-        printf("FAIL\n    %s:%d: %s != %s\n", __FILE__, __LINE__, #a, #b); \
-        testsFailed++; return; \
-    } \
-} while(0)
-
-#define ASSERT_NEAR(a, b, eps) do { \
-    if (std::fabs((a) - (b)) > (eps)) { \
-        printf("FAIL\n    %s:%d: %s (%f) !~= %s (%f)\n", __FILE__, __LINE__, #a, (double)(a), #b, (double)(b)); \
-        testsFailed++; return; \
-    } \
-} while(0)
-
-#define ASSERT_TRUE(x) do { \
-    if (!(x)) { \
-        printf("FAIL\n    %s:%d: %s\n", __FILE__, __LINE__, #x); \
-        testsFailed++; return; \
-    } \
-} while(0)
-
-#define PASS() do { printf("OK\n"); testsPassed++; } while(0)
-
 // ===== PacketWriter/PacketReader roundtrip tests =====
 
 TEST(writer_reader_u8) {
@@ -508,8 +475,5 @@ TEST(create_object_packet_size_reasonable) {
 // ===== Main =====
 
 int main() {
-    printf("\n=== Nova Replication System Tests ===\n\n");
-    // Tests are auto-registered via static initialization
-    printf("\nResults: %d passed, %d failed\n\n", testsPassed, testsFailed);
-    return testsFailed > 0 ? 1 : 0;
+    return NovaTest::RunAll("Nova Replication System Tests");
 }
@@ -0,0 +1,224 @@
+// Nova Game Engine - InstanceSerializer Tests
+// Round trips of properties and references, rejection of corrupt streams,
+// and the placeholder path for classes the running build does not know.
+
+#include "TestHarness.hpp"
+#include "Engine/Nova.hpp"
+#include "Engine/Objects/InstanceFactory.hpp"
+#include "Engine/Reflection/ClassDescriptor.hpp"
+#include "Engine/Reflection/InstanceSerializer.hpp"
+#include "Common/BinaryStream.hpp"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace Nova;
+
+template<typename T>
+static std::shared_ptr<T> Create(const std::string& className) {
+    return std::static_pointer_cast<T>(InstanceFactory::Get().Create(className));
+}
+
+// A model of welded parts with varied values, a script and a PrimaryPart
+static std::shared_ptr<Model> BuildModel(int partCount) {
+    auto model = Create<Model>("Model");
+    model->SetName("Fixture");
+    std::shared_ptr<Part> previous;
+    for (int i = 0; i < partCount; i++) {
+        auto part = Create<Part>("Part");
+        part->SetName("Part" + std::to_string(i));
+        part->cframe = CFrame(Vector3(float(i) * 4.0f, -2.5f, float(i) * 0.5f));
+        part->cframe.rotation[0] = Vector3(0.0f, 1.0f, 0.0f);
+        part->cframe.rotation[1] = Vector3(-1.0f, 0.0f, 0.0f);
+        part->size = Vector3(4.0f, 1.2f + float(i), 2.0f);
+        part->anchored = i % 2 == 0;
+        part->canCollide = i % 3 != 0;
+        part->transparency = 0.25f * float(i % 4);
+        part->brickColor = 21 + i;
+        part->topSurface = SurfaceType::Inlets;
+        part->SetParent(model);
+
+        if (previous) {
+            auto weld = Create<Weld>("Weld");
+            weld->c0 = CFrame(Vector3(0.0f, 0.6f, 0.0f));
+            weld->Part0 = previous;
+            weld->Part1 = part;
+            weld->SetParent(part);
+        }
+        previous = part;
+    }
+    model->PrimaryPart = previous;
+
+    auto script = Create<Script>("Script");
+    script->Source = "print(\"hello\")";
+    script->Disabled = true;
+    script->SetParent(model);
+    return model;
+}
+
+// Pre-order walk, the order the serializer numbers instances in
+static void Flatten(const std::shared_ptr<Instance>& root, std::vector<std::shared_ptr<Instance>>& out) {
+    out.push_back(root);
+    for (auto& child : root->GetChildren()) Flatten(child, out);
+}
+
+// Every reflected property, compared through the accessors' binary encoding
+static bool SameProperties(Instance* a, Instance* b) {
+    auto* desc = a->GetDescriptor();
+    if (!desc || desc != b->GetDescriptor()) return false;
+    for (auto& property : desc->flatProperties) {
+        BinaryWriter left, right;
+        property.accessor->write(left, a);
+        property.accessor->write(right, b);
+        if (left.GetData() != right.GetData()) return false;
+    }
+    return true;
+}
+
+static std::vector<uint8_t> SerializeFixture() {
+    return InstanceSerializer::Serialize({ BuildModel(8) });
+}
+
+TEST(roundtrip_properties) {
+    auto model = BuildModel(8);
+    auto bytes = InstanceSerializer::Serialize({ model });
+    auto roots = InstanceSerializer::Deserialize(bytes.data(), bytes.size());
+    ASSERT_EQ(roots.size(), 1u);
+
+    std::vector<std::shared_ptr<Instance>> before, after;
+    Flatten(model, before);
+    Flatten(roots[0], after);
+    ASSERT_EQ(before.size(), after.size());
+    for (size_t i = 0; i < before.size(); i++) {
+        ASSERT_EQ(before[i]->GetClassName(), after[i]->GetClassName());
+        ASSERT_EQ(before[i]->GetName(), after[i]->GetName());
+        ASSERT_TRUE(SameProperties(before[i].get(), after[i].get()));
+    }
+
+    auto part = std::static_pointer_cast<Part>(roots[0]->FindFirstChild("Part3"));
+    ASSERT_TRUE(part != nullptr);
+    ASSERT_NEAR(part->cframe.position.x, 12.0f, 1e-6f);
+    ASSERT_NEAR(part->cframe.rotation[1].x, -1.0f, 1e-6f);
+    ASSERT_EQ(part->anchored, false);
+    ASSERT_EQ(part->brickColor, 24);
+    ASSERT_TRUE(part->topSurface == SurfaceType::Inlets);
+
+    auto script = std::static_pointer_cast<Script>(roots[0]->FindFirstChild("Script"));
+    ASSERT_TRUE(script != nullptr);
+    ASSERT_EQ(script->Source, std::string("print(\"hello\")"));
+    ASSERT_EQ(script->Disabled, true);
+    PASS();
+}
+
+TEST(roundtrip_references) {
+    auto model = BuildModel(8);
+    // A target outside the encoded tree is written as none
+    auto outside = Create<Part>("Part");
+    auto stray = Create<Weld>("Weld");
+    stray->Part0 = outside;
+    stray->Part1 = std::static_pointer_cast<BasePart>(model->GetChildren()[0]);
+    stray->SetParent(model);
+
+    auto bytes = InstanceSerializer::Serialize({ model });
+    auto roots = InstanceSerializer::Deserialize(bytes.data(), bytes.size());
+    ASSERT_EQ(roots.size(), 1u);
+    auto copy = std::static_pointer_cast<Model>(roots[0]);
+    auto& children = copy->GetChildren();
+
+    for (int i = 1; i < 8; i++) {
+        auto part = std::static_pointer_cast<Part>(children[i]);
+        ASSERT_EQ(part->GetChildren().size(), 1u);
+        auto weld = std::static_pointer_cast<Weld>(part->GetChildren()[0]);
+        ASSERT_TRUE(weld->Part0.lock() == children[i - 1]);
+        ASSERT_TRUE(weld->Part1.lock() == part);
+    }
+    ASSERT_TRUE(copy->PrimaryPart.lock() == children[7]);
+
+    auto strayCopy = std::static_pointer_cast<Weld>(children.back());
+    ASSERT_TRUE(strayCopy->Part0.expired());
+    ASSERT_TRUE(strayCopy->Part1.lock() == children[0]);
+    PASS();
+}
+
+TEST(rejects_bad_magic) {
+    auto bytes = SerializeFixture();
+    bytes[0] = 'X';
+    ASSERT_TRUE(!InstanceSerializer::IsStream(bytes.data(), bytes.size()));
+    ASSERT_TRUE(InstanceSerializer::Deserialize(bytes.data(), bytes.size()).empty());
+    ASSERT_TRUE(InstanceSerializer::Deserialize(bytes.data(), 2).empty());
+    PASS();
+}
+
+TEST(rejects_unknown_version) {
+    auto bytes = SerializeFixture();
+    bytes[4] = static_cast<uint8_t>(InstanceSerializer::Version + 1);
+    ASSERT_TRUE(InstanceSerializer::Deserialize(bytes.data(), bytes.size()).empty());
+    PASS();
+}
+
+TEST(rejects_truncated) {
+    auto bytes = SerializeFixture();
+    for (size_t size = 0; size < bytes.size(); size++) {
+        ASSERT_TRUE(InstanceSerializer::Deserialize(bytes.data(), size).empty());
+    }
+    PASS();
+}
+
+TEST(rejects_corrupt_counts) {
+    // Instance count far beyond what the remaining bytes could describe
+    BinaryWriter out;
+    out.WriteBytes(reinterpret_cast<const uint8_t*>("NVSB"), 4);
+    out.WriteVarUInt(InstanceSerializer::Version);
+    out.WriteVarUInt(1u << 30);
+    out.WriteVarUInt(1);
+    ASSERT_TRUE(InstanceSerializer::Deserialize(out.GetData().data(), out.Size()).empty());
+
+    // An instance that no chunk assigns a class to
+    BinaryWriter orphan;
+    orphan.WriteBytes(reinterpret_cast<const uint8_t*>("NVSB"), 4);
+    orphan.WriteVarUInt(InstanceSerializer::Version);
+    orphan.WriteVarUInt(2);
+    orphan.WriteVarUInt(1);
+    orphan.WriteString("Model");
+    orphan.WriteVarUInt(1);
+    orphan.WriteVarUInt(0);
+    orphan.WriteString("A");
+    orphan.WriteString("B");
+    orphan.WriteVarUInt(0);
+    orphan.WriteVarUInt(1);
+    orphan.WriteVarUInt(0);
+    orphan.WriteVarUInt(0);
+    ASSERT_TRUE(InstanceSerializer::Deserialize(orphan.GetData().data(), orphan.Size()).empty());
+    PASS();
+}
+
+TEST(unknown_class_placeholder) {
+    auto bytes = SerializeFixture();
+    // Rename the Weld chunk's class in the chunk table, which precedes the names
+    const uint8_t weld[] = { 4, 'W', 'e', 'l', 'd' };
+    auto it = std::search(bytes.begin(), bytes.end(), std::begin(weld), std::end(weld));
+    ASSERT_TRUE(it != bytes.end());
+    it[2] = 'x';
+
+    auto roots = InstanceSerializer::Deserialize(bytes.data(), bytes.size());
+    ASSERT_EQ(roots.size(), 1u);
+    auto copy = std::static_pointer_cast<Model>(roots[0]);
+    ASSERT_EQ(copy->CountDescendants(), BuildModel(8)->CountDescendants());
+
+    auto part = std::static_pointer_cast<Part>(copy->FindFirstChild("Part5"));
+    ASSERT_TRUE(part != nullptr);
+    ASSERT_EQ(part->brickColor, 26);
+    ASSERT_EQ(part->GetChildren().size(), 1u);
+    auto placeholder = part->GetChildren()[0];
+    ASSERT_EQ(placeholder->GetClassName(), std::string(InstanceSerializer::PlaceholderClass));
+    ASSERT_EQ(placeholder->GetName(), std::string("Weld"));
+    // The unknown class's references are not applied to the placeholder
+    ASSERT_TRUE(std::static_pointer_cast<Model>(placeholder)->PrimaryPart.expired());
+    ASSERT_TRUE(copy->PrimaryPart.lock() == copy->FindFirstChild("Part7"));
+    PASS();
+}
+
+int main() {
+    RegisterClasses();
+    return NovaTest::RunAll("Nova InstanceSerializer Tests");
+}
@@ -0,0 +1,180 @@
+// Nova Game Engine - Workspace Tests
+// The incremental part registry: cachedParts, workspaceIndex and the
+// PartStore must track the tree through every way parts enter and leave it.
+
+#include "TestHarness.hpp"
+#include "Engine/Nova.hpp"
+#include "Engine/Objects/InstanceFactory.hpp"
+#include "Engine/Reflection/ClassDescriptor.hpp"
+#include <memory>
+#include <string>
+
+using namespace Nova;
+
+template<typename T>
+static std::shared_ptr<T> Create(const std::string& className) {
+    return std::static_pointer_cast<T>(InstanceFactory::Get().Create(className));
+}
+
+// Every part under root sits in cachedParts at its workspaceIndex, and the
+// store's slot holds that part's state
+static bool RegistryMatches(Workspace& ws, const std::shared_ptr<Instance>& root, size_t expected) {
+    if (ws.cachedParts.size() != expected || ws.partStore.Size() != expected) return false;
+    bool ok = true;
+    root->ForEachDescendant([&](const std::shared_ptr<Instance>& inst) {
+        if (!inst->IsA<BasePart>()) return;
+        auto* part = static_cast<BasePart*>(inst.get());
+        uint32_t index = part->workspaceIndex;
+        if (index >= ws.cachedParts.size() || ws.cachedParts[index].get() != part) { ok = false; return; }
+        if (ws.partStore.cframes[index].position != part->cframe.position) ok = false;
+        if (ws.partStore.sizes[index] != part->GetSize()) ok = false;
+    });
+    return ok;
+}
+
+static std::shared_ptr<Model> BuildModel(int partCount) {
+    auto model = Create<Model>("Model");
+    for (int i = 0; i < partCount; i++) {
+        auto part = Create<Part>("Part");
+        part->SetName("Part" + std::to_string(i));
+        part->cframe = CFrame(Vector3(float(i) * 4.0f, 10.0f, 0.0f));
+        part->anchored = true;
+        part->SetParent(model);
+    }
+    return model;
+}
+
+TEST(parts_added_to_live_workspace) {
+    auto dm = std::make_shared<DataModel>();
+    auto ws = dm->GetService<Workspace>();
+    auto model = BuildModel(5);
+    model->SetParent(ws);
+    ASSERT_TRUE(RegistryMatches(*ws, ws, 5));
+
+    model->GetChildren()[0]->SetParent(nullptr);
+    ASSERT_TRUE(RegistryMatches(*ws, ws, 4));
+    PASS();
+}
+
+TEST(populated_workspace_attached_to_datamodel) {
+    // The order LevelLoader::AttachPlace uses: build the Workspace detached,
+    // then parent it into a DataModel that has none yet
+    auto ws = Create<Workspace>("Workspace");
+    BuildModel(6)->SetParent(ws);
+    auto loose = Create<Part>("Part");
+    loose->anchored = true;
+    loose->SetParent(ws);
+    ASSERT_TRUE(ws->cachedParts.empty());
+
+    auto dm = std::make_shared<DataModel>();
+    ws->SetParent(dm);
+    ASSERT_TRUE(dm->FindService<Workspace>() == ws.get());
+    ASSERT_TRUE(loose->IsInWorkspace());
+    ASSERT_TRUE(RegistryMatches(*ws, ws, 7));
+    ASSERT_TRUE(loose->IsPhysicsRegistered());
+    PASS();
+}
+
+// The store slot of a registered part holds exactly what its members say
+static bool StoreMatches(BasePart& part) {
+    Workspace* ws = part.registeredWorkspace;
+    if (!ws || part.workspaceIndex >= ws->partStore.Size()) return false;
+    uint32_t i = part.workspaceIndex;
+    auto& store = ws->partStore;
+    return store.cframes[i].position == part.cframe.position
+        && store.cframes[i].rotation == part.cframe.rotation
+        && store.sizes[i] == part.GetSize()
+        && store.colors[i] == part.GetColor()
+        && store.surfaces[i] == PartSurfaces{
+            uint8_t(part.frontSurface), uint8_t(part.backSurface), uint8_t(part.leftSurface),
+            uint8_t(part.rightSurface), uint8_t(part.topSurface), uint8_t(part.bottomSurface) }
+        && store.networkIDs[i] == part.networkID;
+}
+
+// A reflected write the way LuaNewIndex and the network apply it
+static bool WriteProperty(BasePart& part, const std::string& name, const PropertyValue& value) {
+    auto* desc = part.GetDescriptor();
+    auto* accessor = desc ? desc->FindProperty(name) : nullptr;
+    if (!accessor || !accessor->set(&part, value)) return false;
+    part.OnPropertyChanged(name);
+    return true;
+}
+
+TEST(hot_state_follows_every_mutator) {
+    auto dm = std::make_shared<DataModel>();
+    auto ws = dm->GetService<Workspace>();
+    auto model = BuildModel(4);
+    model->SetParent(ws);
+    auto part = std::static_pointer_cast<BasePart>(model->GetChildren()[2]);
+    ASSERT_TRUE(part->registeredWorkspace == ws.get());
+    ASSERT_TRUE(StoreMatches(*part));
+
+    CFrame turned(Vector3(1.0f, 2.0f, 3.0f));
+    turned.rotation[0] = Vector3(0.0f, 0.0f, -1.0f);
+    turned.rotation[2] = Vector3(1.0f, 0.0f, 0.0f);
+    ASSERT_TRUE(WriteProperty(*part, "CFrame", PropertyValue(turned)));
+    ASSERT_TRUE(StoreMatches(*part));
+    ASSERT_TRUE(WriteProperty(*part, "Size", PropertyValue(Vector3(6.0f, 2.0f, 1.0f))));
+    ASSERT_TRUE(StoreMatches(*part));
+    ASSERT_TRUE(WriteProperty(*part, "Transparency", PropertyValue(0.75)));
+    ASSERT_TRUE(StoreMatches(*part));
+    ASSERT_TRUE(WriteProperty(*part, "BrickColor", PropertyValue(21)));
+    ASSERT_TRUE(StoreMatches(*part));
+    for (const char* surface : { "TopSurface", "BottomSurface", "LeftSurface", "RightSurface", "FrontSurface", "BackSurface" }) {
+        ASSERT_TRUE(WriteProperty(*part, surface, PropertyValue(int(SurfaceType::Weld))));
+        ASSERT_TRUE(StoreMatches(*part));
+    }
+
+    part->SetCFrame(CFrame(Vector3(-8.0f, 5.0f, 0.5f)));
+    ASSERT_TRUE(StoreMatches(*part));
+
+    part->SetNetworkTargetCFrame(CFrame(Vector3(0.0f, 40.0f, 0.0f)));
+    part->UpdateNetworkInterpolation(0.02f);
+    ASSERT_TRUE(StoreMatches(*part));
+    part->UpdateNetworkInterpolation(1.0f);
+    ASSERT_NEAR(part->cframe.position.y, 40.0f, 1e-4f);
+    ASSERT_TRUE(StoreMatches(*part));
+
+    part->networkID = 77;
+    part->SyncHotState();
+    ASSERT_TRUE(StoreMatches(*part));
+
+    // Swap-removing a neighbour moves another part into its slot; the store follows
+    model->GetChildren()[0]->SetParent(nullptr);
+    ASSERT_TRUE(StoreMatches(*part));
+    ASSERT_TRUE(RegistryMatches(*ws, ws, 3));
+
+    // Moving to another world re-registers there
+    auto otherDM = std::make_shared<DataModel>();
+    auto otherWS = otherDM->GetService<Workspace>();
+    part->SetParent(otherWS);
+    ASSERT_TRUE(part->registeredWorkspace == otherWS.get());
+    ASSERT_TRUE(StoreMatches(*part));
+    ASSERT_EQ(ws->cachedParts.size(), 2u);
+
+    part->SetParent(nullptr);
+    ASSERT_TRUE(part->registeredWorkspace == nullptr);
+    part->SetCFrame(CFrame(Vector3(0.0f)));
+    PASS();
+}
+
+TEST(destroyed_workspace_releases_parts) {
+    auto dm = std::make_shared<DataModel>();
+    auto ws = dm->GetService<Workspace>();
+    BuildModel(3)->SetParent(ws);
+    auto part = std::static_pointer_cast<BasePart>(ws->GetChildren()[0]->GetChildren()[0]);
+    ASSERT_EQ(ws->cachedParts.size(), 3u);
+    ASSERT_TRUE(part->IsPhysicsRegistered());
+
+    ws->Destroy();
+    ASSERT_TRUE(ws->cachedParts.empty());
+    ASSERT_EQ(ws->partStore.Size(), 0u);
+    ASSERT_EQ(part->workspaceIndex, BasePart::InvalidWorkspaceIndex);
+    ASSERT_TRUE(!part->IsPhysicsRegistered());
+    PASS();
+}
+
+int main() {
+    RegisterClasses();
+    return NovaTest::RunAll("Nova Workspace Tests");
+}
@@ -0,0 +1,109 @@
+// Nova Game Engine - synthetic place generator
+// Shared by NovaPlaceGen and the load benchmarks. Output depends only on the
+// options: the random stream is mt19937, whose sequence is fixed by the
+// standard, and values are derived from its raw output rather than through
+// the implementation-defined std distributions.
+
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <ostream>
+#include <random>
+#include <string>
+
+namespace Nova {
+    class PlaceGenerator {
+    public:
+        struct Options {
+            int parts = 10000;
+            float jointDensity = 0.5f;  // Chance a part is welded to the previous part of its cluster
+            int modelDepth = 0;         // Models nested around each cluster; 0 puts parts straight in Workspace
+            int clusterSize = 20;       // Parts per cluster
+            int scripts = 0;            // Scripts directly under Workspace
+            float anchored = 1.0f;      // Fraction of parts that are anchored
+            uint32_t seed = 1;
+        };
+
+        struct Stats {
+            int parts = 0;
+            int joints = 0;
+            int models = 0;
+            int scripts = 0;
+        };
+
+        // Writes a complete .rbxl document
+        static Stats WriteXml(std::ostream& out, const Options& options) {
+            Stats stats;
+            std::mt19937 rng(options.seed);
+            auto chance = [&](float p) { return float(rng() >> 8) * (1.0f / 16777216.0f) < p; };
+
+            out << "<roblox version=\"4\">\n"
+                << "<Item class=\"Workspace\" referent=\"RBXWS\"><Properties>"
+                << "<string name=\"Name\">Workspace</string></Properties>\n";
+
+            int clusterSize = options.clusterSize > 0 ? options.clusterSize : 1;
+            for (int first = 0; first < options.parts; first += clusterSize) {
+                int cluster = first / clusterSize;
+                for (int level = 0; level < options.modelDepth; level++) {
+                    out << "<Item class=\"Model\" referent=\"RBXM" << cluster << "_" << level << "\"><Properties>"
+                        << "<string name=\"Name\">Model" << cluster << "_" << level << "</string>";
+                    if (level == options.modelDepth - 1) out << "<Ref name=\"PrimaryPart\">RBX" << first << "</Ref>";
+                    out << "</Properties>\n";
+                    stats.models++;
+                }
+
+                // Clusters sit on a 32x32 grid, stacking upwards once it is full
+                float cx = float(cluster % 32) * 40.0f;
+                float cy = float(cluster / 1024) * 40.0f;
+                float cz = float((cluster / 32) % 32) * 40.0f;
+                int last = std::min(first + clusterSize, options.parts);
+                for (int i = first; i < last; i++) {
+                    int j = i - first;
+                    WritePart(out, i, cx + float(j % 5) * 4.0f, cy + float(j / 5) * 1.2f + 0.6f, cz,
+                        21 + int(rng() % 8), chance(options.anchored));
+                    if (j > 0 && chance(options.jointDensity)) {
+                        out << "<Item class=\"Weld\" referent=\"RBXW" << i << "\"><Properties>"
+                            << "<string name=\"Name\">Weld</string>"
+                            << "<Ref name=\"Part0\">RBX" << i - 1 << "</Ref>"
+                            << "<Ref name=\"Part1\">RBX" << i << "</Ref>"
+                            << "</Properties></Item>";
+                        stats.joints++;
+                    }
+                    out << "</Item>\n";
+                    stats.parts++;
+                }
+
+                for (int level = 0; level < options.modelDepth; level++) out << "</Item>\n";
+            }
+
+            for (int i = 0; i < options.scripts; i++) {
+                out << "<Item class=\"Script\" referent=\"RBXS" << i << "\"><Properties>"
+                    << "<bool name=\"Disabled\">false</bool>"
+                    << "<string name=\"Name\">Script" << i << "</string>"
+                    << "<string name=\"Source\">local n = 0 for i = 1, " << 10 + i % 90 << " do n = n + i end</string>"
+                    << "</Properties></Item>\n";
+                stats.scripts++;
+            }
+
+            out << "</Item>\n</roblox>\n";
+            return stats;
+        }
+
+    private:
+        // Leaves the Item open so joints can be written as children
+        static void WritePart(std::ostream& out, int i, float x, float y, float z, int brickColor, bool anchored) {
+            out << "<Item class=\"Part\" referent=\"RBX" << i << "\"><Properties>"
+                << "<bool name=\"Anchored\">" << (anchored ? "true" : "false") << "</bool>"
+                << "<int name=\"BrickColor\">" << brickColor << "</int>"
+                << "<CoordinateFrame name=\"CFrame\"><X>" << x << "</X><Y>" << y << "</Y><Z>" << z << "</Z>"
+                << "<R00>1</R00><R01>0</R01><R02>0</R02><R10>0</R10><R11>1</R11><R12>0</R12>"
+                << "<R20>0</R20><R21>0</R21><R22>1</R22></CoordinateFrame>"
+                << "<bool name=\"CanCollide\">true</bool>"
+                << "<string name=\"Name\">Part" << i << "</string>"
+                << "<float name=\"Transparency\">0</float>"
+                << "<token name=\"TopSurface\">3</token>"
+                << "<Vector3 name=\"size\"><X>4</X><Y>1.2</Y><Z>2</Z></Vector3>"
+                << "</Properties>";
+        }
+    };
+}
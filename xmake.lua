@@ -57,17 +57,14 @@ rule("hlsl2spv")
     end)
 rule_end()
 
-target("Nova07")
-    set_kind("binary")
-    set_default(true)
-
-    add_files("src/**.cpp|ncc_main.cpp")
-    add_includedirs("src")
+target("NovaCore")
+    set_kind("static")
+    set_default(false)
 
-    add_rules("hlsl2spv")
-    add_files("shaders/**.hlsl")
+    add_files("src/**.cpp|main.cpp|ncc_main.cpp")
+    add_includedirs("src", { public = true })
 
-    add_defines("TRACY_ENABLE")
+    add_defines("TRACY_ENABLE", { public = true })
 
     add_packages(
         "libsdl3",
@@ -80,42 +77,131 @@ target("Nova07")
         "pugixml",
         "enet",
         "zstd",
-        "tracy"
+        "tracy",
+        { public = true }
     )
 
+target("Nova07")
+    set_kind("binary")
+    set_default(true)
+
+    add_files("src/main.cpp")
+    add_deps("NovaCore")
+
+    add_rules("hlsl2spv")
+    add_files("shaders/**.hlsl")
+
 target("NCCService")
     set_kind("binary")
     set_default(false)
 
-    add_files("src/**.cpp|main.cpp")
-    add_includedirs("src")
+    add_files("src/ncc_main.cpp")
+    add_deps("NovaCore")
 
     add_rules("hlsl2spv")
     add_files("shaders/**.hlsl")
 
-    add_defines("TRACY_ENABLE")
+target("ReplicationTests")
+    set_kind("binary")
+    set_default(false)
+
+    add_files("tests/test_replication.cpp")
+    add_includedirs("src", "tests")
 
     add_packages(
-        "libsdl3",
-        "libsdl3_image",
-        "shaderc",
-        "luau",
-        "luabridge3",
-        "glm",
-        "joltphysics",
-        "pugixml",
-        "enet",
-        "zstd",
-        "tracy"
+        "glm"
     )
 
-target("ReplicationTests")
+target("SerializerTests")
     set_kind("binary")
     set_default(false)
 
-    add_files("tests/test_replication.cpp")
+    add_files("tests/test_serializer.cpp")
+    add_includedirs("tests")
+    add_deps("NovaCore")
+
+target("LevelLoaderTests")
+    set_kind("binary")
+    set_default(false)
+
+    add_files("tests/test_level_loader.cpp")
+    add_includedirs("tests", "tools")
+    add_deps("NovaCore")
+
+target("WorkspaceTests")
+    set_kind("binary")
+    set_default(false)
+
+    add_files("tests/test_workspace.cpp")
+    add_includedirs("tests")
+    add_deps("NovaCore")
+
+target("CloneBench")
+    set_kind("binary")
+    set_default(false)
+
+    add_files("bench/bench_clone.cpp")
+    add_deps("NovaCore")
+
+target("PropertyValueBench")
+    set_kind("binary")
+    set_default(false)
+
+    add_files("bench/bench_property_value.cpp")
     add_includedirs("src")
 
     add_packages(
         "glm"
     )
+
+target("SerializerBench")
+    set_kind("binary")
+    set_default(false)
+
+    add_files("bench/bench_serializer.cpp")
+    add_deps("NovaCore")
+
+target("NovaPlaceConvert")
+    set_kind("binary")
+    set_default(false)
+
+    add_files("tools/place_convert.cpp")
+    add_deps("NovaCore")
+
+target("LevelLoadBench")
+    set_kind("binary")
+    set_default(false)
+
+    add_files("bench/bench_level_load.cpp")
+    add_includedirs("tools")
+    add_deps("NovaCore")
+
+target("PrototypeCacheBench")
+    set_kind("binary")
+    set_default(false)
+
+    add_files("bench/bench_prototype_cache.cpp")
+    add_deps("NovaCore")
+
+target("CheckpointBench")
+    set_kind("binary")
+    set_default(false)
+
+    add_files("bench/bench_checkpoint.cpp")
+    add_includedirs("tools")
+    add_deps("NovaCore")
+
+target("NovaPlaceGen")
+    set_kind("binary")
+    set_default(false)
+
+    add_files("tools/place_gen.cpp")
+    add_includedirs("tools")
+    add_deps("NovaCore")
+
+target("LoadBench")
+    set_kind("binary")
+    set_default(false)
+
+    add_files("bench/bench_load.cpp")
+    add_deps("NovaCore")